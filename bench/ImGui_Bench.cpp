@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include <Engine/UI/ImGui.hpp>
+#include <Engine/UI/ImGui_Impl_Engine.hpp>
+
+// headless benchmark for the Rift ImGui backend: runs the full ImGui_BeginFrame / ImGui_EndFrame pipeline without
+// a graphics context or renderer, UIRenderItems are counted and dropped by a submit hook.
+// fonts are loaded from DataRaw/ relative to the working directory, the build copies the assets next to the binary.
+
+static std::atomic<uint64_t> g_AllocationCount{0};
+
+void *operator new(size_t size) {
+    g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void *ptr = malloc(size ? size : 1)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+namespace engine::ui::bench {
+    struct BenchWorkload {
+        const char *m_Name;
+        void (*m_Run)();
+    };
+
+    struct BenchResult {
+        std::vector<float> m_FrameMs;
+        uint64_t m_Allocations = 0;
+        uint64_t m_AllocatedBytes = 0;
+        size_t m_PeakBytesInUse = 0;
+        uint64_t m_Vertices = 0;
+        uint64_t m_Submits = 0;
+    };
+
+    static uint64_t g_SubmittedItems = 0;
+
+    static void Bench_Submit(core::runtime::graphics::UIRenderItem &&, void *) {
+        g_SubmittedItems++;
+    }
+
+    static void Bench_BeginWindow(const char *name) {
+        ImGui::SetNextWindowPos(ImVec2(20.f, 20.f), ImGuiCond_Always);
+        ImGui::SetNextWindowSize(ImVec2(1200.f, 900.f), ImGuiCond_Always);
+        ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+    }
+
+    static void Bench_Demo() {
+        ImGui::ShowDemoWindow();
+    }
+
+    static void Bench_Table() {
+        Bench_BeginWindow("Bench Table");
+
+        if (ImGui::BeginTable("##table", 6)) {
+            for (int column = 0; column < 6; column++) {
+                ImGui::TableSetupColumn("Column");
+            }
+
+            ImGui::TableHeadersRow();
+
+            for (int row = 0; row < 500; row++) {
+                ImGui::TableNextRow();
+
+                for (int column = 0; column < 6; column++) {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d:%d %.3f", row, column, row * 0.5f + column);
+                }
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }
+
+    static void Bench_Text() {
+        Bench_BeginWindow("Bench Text");
+
+        for (int line = 0; line < 3000; line++) {
+            ImGui::Text("[%05d] the quick brown fox jumps over the lazy dog 0123456789", line);
+        }
+
+        ImGui::End();
+    }
+
+    static void Bench_Plots() {
+        static float samples[2000];
+        static int frame = 0;
+
+        frame++;
+
+        for (int i = 0; i < IM_ARRAYSIZE(samples); i++) {
+            samples[i] = (float) ((i * 7 + frame * 13) % 101) / 100.f;
+        }
+
+        Bench_BeginWindow("Bench Plots");
+
+        for (int plot = 0; plot < 8; plot++) {
+            char label[16];
+            snprintf(label, sizeof(label), "##plot%d", plot);
+            ImGui::PlotLines(label, samples, IM_ARRAYSIZE(samples), plot * 100, nullptr, 0.f, 1.f, ImVec2(1100.f, 90.f));
+        }
+
+        ImGui::End();
+    }
+
+    static BenchResult Bench_Run(const BenchWorkload &workload, int warmupFrames, int frames) {
+        BenchResult result;
+        result.m_FrameMs.reserve(frames);
+
+        for (int i = 0; i < warmupFrames + frames; i++) {
+            bool measured = i >= warmupFrames;
+
+            uint64_t allocations = g_AllocationCount.load(std::memory_order_relaxed);
+            g_SubmittedItems = 0;
+
+            auto start = std::chrono::steady_clock::now();
+
+            if (ImGui_BeginFrame()) {
+                workload.m_Run();
+            }
+
+            ImGui_EndFrame();
+
+            auto end = std::chrono::steady_clock::now();
+
+            if (measured) {
+                result.m_FrameMs.push_back(std::chrono::duration<float, std::milli>(end - start).count());
+                auto allocStats = ImGui_GetAllocatorStats();
+
+                // ImGui's own allocations go through the pool allocator, not operator new
+                result.m_Allocations += g_AllocationCount.load(std::memory_order_relaxed) - allocations +
+                                        allocStats.FrameAllocationCount;
+                result.m_AllocatedBytes += allocStats.FrameAllocatedBytes;
+                result.m_PeakBytesInUse = allocStats.PeakBytesInUse;
+                result.m_Vertices += ImGui_GetRenderStats().SubmittedVertexCount;
+                result.m_Submits += g_SubmittedItems;
+            }
+        }
+
+        return result;
+    }
+
+    struct BenchFontState {
+        int m_GlyphCount;
+        ImWchar m_FallbackChar;
+        ImWchar m_EllipsisChar;
+    };
+
+    static BenchFontState Bench_GetFontState() {
+        ImFont *font = ImGui::GetIO().Fonts->Fonts[0];
+        return {font->Glyphs.Size, font->FallbackChar, font->EllipsisChar};
+    }
+
+    // the first start rasterizes the fonts and writes the atlas cache, the second one loads it. the warm start's
+    // context stays initialized, so every workload runs on the fonts restored from the cache
+    static bool Bench_Startup(const char *cachePath) {
+        remove(cachePath);
+        ImGui_SetFontAtlasCachePath(cachePath);
+
+        auto start = std::chrono::steady_clock::now();
+        ImGui_Initialize(nullptr, nullptr);
+        auto coldMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        BenchFontState cold = Bench_GetFontState();
+        ImGui_Shutdown();
+
+        start = std::chrono::steady_clock::now();
+        ImGui_Initialize(nullptr, nullptr);
+        auto warmMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        BenchFontState warm = Bench_GetFontState();
+        printf("startup  cold %.2f ms, warm %.2f ms (font atlas cache)\n", coldMs, warmMs);
+
+        if (cold.m_GlyphCount != warm.m_GlyphCount || cold.m_FallbackChar != warm.m_FallbackChar ||
+            cold.m_EllipsisChar != warm.m_EllipsisChar) {
+            printf("font atlas cache: warm start fonts differ from the built ones\n");
+            return false;
+        }
+
+        return true;
+    }
+
+    static float Bench_Percentile(std::vector<float> &values, float percentile) {
+        if (values.empty()) {
+            return 0.f;
+        }
+
+        auto idx = (size_t) (percentile * (float) (values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + idx, values.end());
+        return values[idx];
+    }
+
+    static ImGui_RiftFlags Bench_ParseFlags(const char *list) {
+        ImGui_RiftFlags flags = ImGui_RiftFlags_None;
+
+        if (strstr(list, "merge")) { flags |= ImGui_RiftFlags_MergeCommands; }
+        if (strstr(list, "retained")) { flags |= ImGui_RiftFlags_RetainedSubmission; }
+        if (strstr(list, "parallel")) { flags |= ImGui_RiftFlags_ParallelConversion; }
+
+        return flags;
+    }
+
+    static int Bench_Main(int argc, char **argv) {
+        int warmupFrames = 30;
+        int frames = 300;
+        ImGui_RiftFlags flags = ImGui_RiftFlags_None;
+        const char *only = nullptr;
+
+        for (int i = 1; i < argc; i++) {
+            if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+                frames = atoi(argv[++i]);
+            } else if (!strcmp(argv[i], "--warmup") && i + 1 < argc) {
+                warmupFrames = atoi(argv[++i]);
+            } else if (!strcmp(argv[i], "--flags") && i + 1 < argc) {
+                flags = Bench_ParseFlags(argv[++i]);
+            } else if (!strcmp(argv[i], "--workload") && i + 1 < argc) {
+                only = argv[++i];
+            } else {
+                printf("usage: %s [--frames N] [--warmup N] [--flags merge,retained,parallel] [--workload name]\n", argv[0]);
+                return 1;
+            }
+        }
+
+        static const BenchWorkload workloads[] = {
+                {"demo",  Bench_Demo},
+                {"table", Bench_Table},
+                {"text",  Bench_Text},
+                {"plots", Bench_Plots},
+        };
+
+        if (!Bench_Startup("bench_atlas.cache")) {
+            ImGui_Shutdown();
+            return 1;
+        }
+
+        ImGui::GetIO().IniFilename = nullptr;
+
+        ImGui_ImplEngine_SetHeadlessDisplaySize({1920.f, 1080.f});
+        ImGui_ImplEngine_SetSubmitHook(Bench_Submit, nullptr);
+        // only the demo workload draws the demo window
+        ImGui_SetFlags(flags | ImGui_RiftFlags_HideDemoWindow);
+
+        printf("%-8s %9s %9s %9s %9s %12s %12s %10s %12s %10s\n",
+               "workload", "p50 ms", "p90 ms", "p99 ms", "max ms", "allocs/frm", "vtx/frm", "items/frm",
+               "KB alloc/frm", "peak KB");
+
+        for (const auto &workload: workloads) {
+            if (only && strcmp(only, workload.m_Name) != 0) {
+                continue;
+            }
+
+            auto result = Bench_Run(workload, warmupFrames, frames);
+            auto count = (double) (result.m_FrameMs.empty() ? 1 : result.m_FrameMs.size());
+
+            float p50 = Bench_Percentile(result.m_FrameMs, 0.50f);
+            float p90 = Bench_Percentile(result.m_FrameMs, 0.90f);
+            float p99 = Bench_Percentile(result.m_FrameMs, 0.99f);
+            float max = Bench_Percentile(result.m_FrameMs, 1.00f);
+
+            printf("%-8s %9.3f %9.3f %9.3f %9.3f %12.1f %12.0f %10.1f %12.1f %10.1f\n",
+                   workload.m_Name, p50, p90, p99, max,
+                   (double) result.m_Allocations / count,
+                   (double) result.m_Vertices / count,
+                   (double) result.m_Submits / count,
+                   (double) result.m_AllocatedBytes / 1024.0 / count,
+                   (double) result.m_PeakBytesInUse / 1024.0);
+        }
+
+        ImGui_Shutdown();
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    return engine::ui::bench::Bench_Main(argc, argv);
+}
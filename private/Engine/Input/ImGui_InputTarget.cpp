@@ -1,17 +1,61 @@
+#include <algorithm>
+#include <iterator>
+
 #include <Engine/Input/ImGui_InputTarget.hpp>
+#include <Engine/UI/ImGui_Impl_Engine.hpp>
 
 #include <imgui_internal.h>
 
 namespace engine::input {
+    // 1.91.3 moved InputText from wide chars to UTF-8 storage; before, stb positions count wide chars
+    static int ImGuiInputTarget_GetTextLength(const ImGuiInputTextState *state) {
+#if IMGUI_VERSION_NUM >= 19130
+        return state->TextLen;
+#else
+        return state->CurLenA;
+#endif
+    }
+
+    static int ImGuiInputTarget_ToStateIndex(const ImGuiInputTextState *state, int offset) {
+#if IMGUI_VERSION_NUM >= 19130
+        return offset;
+#else
+        return ImTextCountCharsFromUtf8(state->TextA.Data, state->TextA.Data + offset);
+#endif
+    }
+
+    static int ImGuiInputTarget_ToByteOffset(const ImGuiInputTextState *state, int index) {
+#if IMGUI_VERSION_NUM >= 19130
+        return index;
+#else
+        return ImTextCountUtf8BytesFromStr(state->TextW.Data, state->TextW.Data + index);
+#endif
+    }
+
+    static bool ImGuiInputTarget_IsContinuationByte(char c) {
+        return ((unsigned char) c & 0xC0) == 0x80;
+    }
+
     std::string ImGuiInputTarget::GetText() {
+        return std::string(GetTextView());
+    }
+
+    std::string_view ImGuiInputTarget::GetTextView() const {
         if(!m_TextState) {
-            return "";
+            return {};
         }
 
-        return {
-            m_TextState->TextA.Data,
-            m_TextState->TextA.Data + m_TextState->TextA.Size
-        };
+        return {m_TextState->TextA.Data, (size_t) ImGuiInputTarget_GetTextLength(m_TextState)};
+    }
+
+    void ImGuiInputTarget::GetSelection(int &start, int &end) const {
+        if(!m_TextState) {
+            start = end = 0;
+            return;
+        }
+
+        start = ImGuiInputTarget_ToByteOffset(m_TextState, m_TextState->GetSelectionStart());
+        end = ImGuiInputTarget_ToByteOffset(m_TextState, m_TextState->GetCursorPos());
     }
 
     void ImGuiInputTarget::SetText(std::string_view text, bool isEnter) {
@@ -20,16 +64,225 @@ namespace engine::input {
             return;
         }
 
-        m_TextState->ClearText();
-        m_IO.AddInputCharactersUTF8(text.data());
+        // diff against the text as it will be once the edits still queued are through
+        std::deque<ImGuiTextEdit> queued;
+
+        {
+            std::lock_guard lock(m_EditLock);
+            queued = m_Edits;
+        }
+
+        std::string pending;
+        std::string_view current = GetTextView();
+
+        if(!queued.empty()) {
+            pending = current;
+
+            // inserts go where the edits before them leave the selection
+            int selectionStart, cursor;
+            GetSelection(selectionStart, cursor);
+
+            for(const auto &edit : queued) {
+                int length = (int) pending.size();
+
+                if(edit.Type == ImGuiTextEditType::TEXT_EDIT_TYPE_SELECT) {
+                    selectionStart = std::clamp(edit.Start, 0, length);
+                    cursor = std::clamp(edit.End, 0, length);
+                } else if(edit.Type == ImGuiTextEditType::TEXT_EDIT_TYPE_REPLACE) {
+                    int start = edit.Start >= 0 ? edit.Start : std::min(selectionStart, cursor);
+                    int end = edit.Start >= 0 ? edit.End : std::max(selectionStart, cursor);
+
+                    start = std::clamp(start, 0, length);
+                    end = std::clamp(end, start, length);
+                    pending.replace(start, end - start, edit.Text);
+
+                    selectionStart = cursor = start + (int) edit.Text.size();
+                }
+            }
+
+            current = pending;
+        }
+
+        size_t maxLength = std::min(current.size(), text.size());
+        size_t prefix = 0;
+
+        while(prefix < maxLength && current[prefix] == text[prefix]) {
+            prefix++;
+        }
+
+        // both ends of the changed span have to fall between characters
+        while(prefix > 0 && ((prefix < current.size() && ImGuiInputTarget_IsContinuationByte(current[prefix])) ||
+                             (prefix < text.size() && ImGuiInputTarget_IsContinuationByte(text[prefix])))) {
+            prefix--;
+        }
+
+        size_t suffix = 0;
+
+        while(suffix < maxLength - prefix &&
+              current[current.size() - 1 - suffix] == text[text.size() - 1 - suffix]) {
+            suffix++;
+        }
+
+        while(suffix > 0 && ImGuiInputTarget_IsContinuationByte(current[current.size() - suffix])) {
+            suffix--;
+        }
+
+        if(prefix + suffix != current.size() || prefix + suffix != text.size()) {
+            ReplaceText((int) prefix, (int) (current.size() - suffix),
+                        text.substr(prefix, text.size() - suffix - prefix));
+        }
 
         if(isEnter) {
-            // simulate enter press
-            m_IO.AddKeyEvent(ImGuiKey_Enter, true);
-            m_IO.AddKeyEvent(ImGuiKey_Enter, false);
+            SubmitEnter();
+        }
+    }
+
+    void ImGuiInputTarget::ReplaceText(int start, int end, std::string_view text) {
+        std::lock_guard lock(m_EditLock);
+        m_Edits.push_back({ImGuiTextEditType::TEXT_EDIT_TYPE_REPLACE, start, end, std::string(text)});
+    }
+
+    void ImGuiInputTarget::InsertText(std::string_view text) {
+        std::lock_guard lock(m_EditLock);
+        m_Edits.push_back({ImGuiTextEditType::TEXT_EDIT_TYPE_REPLACE, -1, -1, std::string(text)});
+    }
+
+    void ImGuiInputTarget::DeleteText(int start, int end) {
+        std::lock_guard lock(m_EditLock);
+        m_Edits.push_back({ImGuiTextEditType::TEXT_EDIT_TYPE_REPLACE, start, end, {}});
+    }
+
+    void ImGuiInputTarget::SetSelection(int start, int end) {
+        std::lock_guard lock(m_EditLock);
+        m_Edits.push_back({ImGuiTextEditType::TEXT_EDIT_TYPE_SELECT, start, end, {}});
+    }
+
+    void ImGuiInputTarget::SetComposition(int start, int end) {
+        std::lock_guard lock(m_EditLock);
+        m_Edits.push_back({ImGuiTextEditType::TEXT_EDIT_TYPE_COMPOSE, start, end, {}});
+    }
+
+    void ImGuiInputTarget::SubmitEnter() {
+        std::lock_guard lock(m_EditLock);
+        m_Edits.push_back({ImGuiTextEditType::TEXT_EDIT_TYPE_ENTER, 0, 0, {}});
+    }
+
+    // edits are sent as a selection followed by typed characters or a delete key, so ImGui applies them with
+    // its undo stack, filters and callbacks intact. an edit elsewhere in the text has to wait for the next frame
+    // once input was queued in this one, its offsets only hold after ImGui processed that input
+    void ImGuiInputTarget::ApplyEdits() {
+        std::deque<ImGuiTextEdit> edits;
+
+        {
+            std::lock_guard lock(m_EditLock);
+            edits.swap(m_Edits);
+        }
+
+        if(!m_TextState || edits.empty()) {
+            return;
+        }
+
+        ApplyQueuedEdits(edits);
+
+        if(edits.empty()) {
+            return;
+        }
+
+        // the rest waits for the next frame, ahead of anything queued meanwhile
+        std::lock_guard lock(m_EditLock);
+        m_Edits.insert(m_Edits.begin(), std::make_move_iterator(edits.begin()), std::make_move_iterator(edits.end()));
+    }
+
+    void ImGuiInputTarget::ApplyQueuedEdits(std::deque<ImGuiTextEdit> &edits) {
+        bool queued = false;
+        // where the queued characters leave the cursor, -1 if unknown
+        int cursor = -1;
+
+        auto select = [this](int start, int end) {
+            int length = ImGuiInputTarget_GetTextLength(m_TextState);
+            start = std::clamp(start, 0, length);
+            end = std::clamp(end, 0, length);
+
+            m_TextState->SetSelection(ImGuiInputTarget_ToStateIndex(m_TextState, start),
+                                      ImGuiInputTarget_ToStateIndex(m_TextState, end));
+        };
+
+        while(!edits.empty()) {
+            auto &edit = edits.front();
+
+            switch(edit.Type) {
+                case ImGuiTextEditType::TEXT_EDIT_TYPE_REPLACE: {
+                    if(edit.Text.empty() && edit.Start == edit.End) {
+                        break;
+                    }
+
+                    bool atCursor = edit.Start < 0 || (edit.Start == edit.End && edit.Start == cursor);
+
+                    if(!atCursor) {
+                        if(queued) {
+                            return;
+                        }
+
+                        select(edit.Start, edit.End);
+
+                        if(edit.Text.empty()) {
+                            // key releases trickle into the next frame anyway, nothing else goes with this one
+                            m_IO.AddKeyEvent(ImGuiKey_Delete, true);
+                            m_IO.AddKeyEvent(ImGuiKey_Delete, false);
+
+                            edits.pop_front();
+                            return;
+                        }
+
+                        cursor = edit.Start;
+                    }
+
+                    if(!edit.Text.empty()) {
+                        m_IO.AddInputCharactersUTF8(edit.Text.c_str());
+                        engine::ui::ImGui_ImplEngine_RequestGlyphs(m_IO.Fonts, edit.Text.c_str());
+                        queued = true;
+                    }
+
+                    cursor = cursor >= 0 ? cursor + (int) edit.Text.size() : -1;
+                    break;
+                }
+                case ImGuiTextEditType::TEXT_EDIT_TYPE_SELECT:
+                    if(queued) {
+                        return;
+                    }
+
+                    select(edit.Start, edit.End);
+                    cursor = edit.Start == edit.End ? edit.End : -1;
+                    break;
+                case ImGuiTextEditType::TEXT_EDIT_TYPE_COMPOSE:
+                    m_CompositionStart = edit.Start;
+                    m_CompositionEnd = edit.End;
+                    break;
+                case ImGuiTextEditType::TEXT_EDIT_TYPE_ENTER:
+                    // simulate enter press
+                    m_IO.AddKeyEvent(ImGuiKey_Enter, true);
+                    m_IO.AddKeyEvent(ImGuiKey_Enter, false);
+
+                    edits.pop_front();
+                    return;
+            }
+
+            edits.pop_front();
         }
     }
 
+    void ImGuiInputTarget::SetTextState(ImGuiInputTextState *state) {
+        // edits were meant for the text of another widget
+        if(!state || !m_TextState || state->ID != m_TextState->ID) {
+            std::lock_guard lock(m_EditLock);
+            m_Edits.clear();
+            m_CompositionStart = -1;
+            m_CompositionEnd = -1;
+        }
+
+        m_TextState = state;
+    }
+
     engine::input::InputTargetType ImGuiInputTarget::GetTargetType() {
         if(m_TextState && (m_TextState->Flags & ImGuiInputTextFlags_Password) > 0) {
             return engine::input::InputTargetType::INPUT_TARGET_TYPE_PASSWORD;
@@ -41,4 +294,4 @@ namespace engine::input {
     ImGuiID ImGuiInputTarget::GetID() const {
         return m_TextState ? m_TextState->ID : 0;
     }
-}
\ No newline at end of file
+}
@@ -1,3 +1,8 @@
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+
 #include <Engine/Input/IInputTarget.hpp>
 
 #include <Engine/UI/ImGui.hpp>
@@ -5,11 +10,32 @@
 struct ImGuiInputTextState;
 
 namespace engine::input {
+    enum class ImGuiTextEditType {
+        // replaces [Start, End) with Text; an empty range inserts, an empty Text deletes
+        TEXT_EDIT_TYPE_REPLACE,
+        // moves the cursor to End, selecting from Start
+        TEXT_EDIT_TYPE_SELECT,
+        // marks [Start, End) as the text still being composed by an IME; nothing is edited
+        TEXT_EDIT_TYPE_COMPOSE,
+        TEXT_EDIT_TYPE_ENTER
+    };
+
+    // one change made by a platform keyboard. offsets are UTF-8 bytes into the text as it is after every edit
+    // queued before this one
+    struct ImGuiTextEdit {
+        ImGuiTextEditType Type;
+        int Start;
+        int End;
+        std::string Text;
+    };
+
     struct ImGuiInputTarget : engine::input::IInputTarget {
         ImGuiInputTarget(ImGuiInputTextState* state, ImGuiIO& io) : m_TextState(state), m_IO(io) {}
 
         std::string GetText() override;
 
+        // keyboards that only know full strings; the new text is diffed against the current one and only the
+        // changed span is edited
         void SetText(std::string_view text, bool isEnter) override;
 
         std::string GetHint() override {
@@ -20,10 +46,40 @@ namespace engine::input {
 
         ImGuiID GetID() const;
 
-        void SetTextState(ImGuiInputTextState* state) { m_TextState = state; }
+        // edit-delta protocol: the edits are queued and applied through ImGui's own text editing by ApplyEdits,
+        // so a keystroke costs the size of the change instead of the size of the text
+        void ReplaceText(int start, int end, std::string_view text);
+        // at the cursor, replacing the selection
+        void InsertText(std::string_view text);
+        void DeleteText(int start, int end);
+        void SetSelection(int start, int end);
+        void SetComposition(int start, int end);
+        void SubmitEnter();
+
+        // no copy; only valid until the next frame
+        std::string_view GetTextView() const;
+        // in UTF-8 bytes, start may be past end for selections made backwards
+        void GetSelection(int &start, int &end) const;
+        // -1 while nothing is being composed
+        int GetCompositionStart() const { return m_CompositionStart; }
+        int GetCompositionEnd() const { return m_CompositionEnd; }
+
+        // hands queued edits to ImGui; called by the backend before every ImGui::NewFrame
+        void ApplyEdits();
+
+        void SetTextState(ImGuiInputTextState* state);
         ImGuiInputTextState* GetTextState() const { return m_TextState; }
     protected:
+        // applies edits from the front of the queue until one has to wait for the next frame
+        void ApplyQueuedEdits(std::deque<ImGuiTextEdit> &edits);
+
         ImGuiInputTextState* m_TextState;
         ImGuiIO& m_IO;
+
+        // keyboards queue edits from their own threads; ApplyEdits takes the queue as a whole
+        std::mutex m_EditLock;
+        std::deque<ImGuiTextEdit> m_Edits;
+        int m_CompositionStart = -1;
+        int m_CompositionEnd = -1;
     };
-}
\ No newline at end of file
+}
@@ -1,40 +1,520 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <Engine/UI/ImGui.hpp>
+#include <Engine/UI/ImGui_Allocator.hpp>
+#include <Engine/UI/ImGui_Engine_Mappings.hpp>
+#include <Engine/UI/ImGui_FontCache.hpp>
 #include <Engine/UI/ImGui_Impl_Engine.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Textures.hpp>
+#include <Engine/UI/ImGui_MappedFile.hpp>
+#include <Engine/UI/ImGui_Profiler.hpp>
+
+#include <Engine/Core/Hashing/FNV.hpp>
 
 #include <imgui_internal.h>
 
+// current ImGui context of the calling thread, see ImGui_Rift_Config.hpp
+thread_local ImGuiContext *g_RiftImGuiContext = nullptr;
+
 namespace engine::ui {
-    static ImGuiContext* g_ImGuiContext;
+    // frames that keep being built after the last activity, letting hover states, fades and queued input settle
+    static constexpr int IDLE_SETTLE_FRAMES = 3;
+    static constexpr int FRAME_TIMING_HISTORY = 128;
 
-    void ImGui_BeginFrame() {
-        if (!g_ImGuiContext) {
-            return;
+    struct ImGui_RiftContext {
+        ImGuiContext *m_Context = nullptr;
+
+        // context whose font atlas this one draws from, and how many contexts draw from this one's
+        ImGui_RiftContext *m_FontOwner = nullptr;
+        int m_FontSharers = 0;
+
+        // bundle fonts are mapped, not copied; the atlas reads them in place for as long as it lives
+        std::vector<std::unique_ptr<ImGui_MappedFile>> m_FontFiles;
+
+        bool m_FrameIdle = false;
+        bool m_AppDirty = true;
+        int m_SettleFramesLeft = 0;
+        float m_MaxIdleInterval = 1.f;
+        uint32_t m_IdleFrameCount = 0;
+        std::chrono::steady_clock::time_point m_LastBuiltFrame;
+
+        ImGui_FrameTiming m_FrameTimings[FRAME_TIMING_HISTORY];
+        int m_FrameTimingCount = 0;
+        int m_FrameTimingHead = 0;
+        ImGui_FrameTiming m_CurrentTiming;
+
+        ImGui_ProfilerFrame m_ProfilerFrame;
+        ImGui_ProfilerHistory m_Profiler;
+        std::chrono::steady_clock::time_point m_WidgetsStart;
+    };
+
+    // the context ImGui_Initialize creates; every function without a handle works on it
+    static ImGui_ContextHandle g_DefaultContext;
+    // nullptr until set, the user cache directory is used then
+    static const char* g_FontAtlasCachePath = nullptr;
+    static bool g_FontAtlasCacheDisabled = false;
+    static const char* g_AssetRoot = "DataRaw/";
+    static bool g_PoolAllocatorEnabled = true;
+
+    // the pool allocator serves every context, so its frame stats are process-wide: counters at the end of the last
+    // frame any context finished, and the activity since the one before
+    static std::mutex g_AllocStatsLock;
+    static ImGui_AllocatorCounters g_AllocCounters = {};
+    static ImGui_AllocatorStats g_AllocFrame;
+
+    static float ImGui_ElapsedMs(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - since).count();
+    }
+
+    // the working directory may be read-only or shared between builds, the cache belongs to the user
+    static const char* ImGui_GetFontAtlasCachePath() {
+        if (g_FontAtlasCachePath || g_FontAtlasCacheDisabled) {
+            return g_FontAtlasCachePath;
+        }
+
+        static std::string defaultPath = [] {
+            std::filesystem::path directory;
+#if defined(_WIN32)
+            if (const char* localAppData = getenv("LOCALAPPDATA")) {
+                directory = localAppData;
+            }
+#elif defined(__APPLE__)
+            if (const char* home = getenv("HOME")) {
+                directory = std::filesystem::path(home) / "Library" / "Caches";
+            }
+#else
+            if (const char* cacheHome = getenv("XDG_CACHE_HOME"); cacheHome && cacheHome[0]) {
+                directory = cacheHome;
+            } else if (const char* home = getenv("HOME")) {
+                directory = std::filesystem::path(home) / ".cache";
+            }
+#endif
+            if (directory.empty()) {
+                return std::string("imgui_atlas.cache");
+            }
+
+            directory /= "Rift";
+
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+
+            return (directory / "imgui_atlas.cache").string();
+        }();
+
+        return defaultPath.c_str();
+    }
+
+    static bool ImGui_ShouldBuildFrame(ImGui_RiftContext *context) {
+        if (!(ImGui_ImplEngine_GetFlags() & ImGui_RiftFlags_IdleThrottling)) {
+            return true;
+        }
+
+        if (ImGui_ImplEngine_ConsumeActivity() || context->m_AppDirty) {
+            context->m_SettleFramesLeft = IDLE_SETTLE_FRAMES;
+        }
+
+        // without a previous frame there is nothing to present again
+        if (context->m_SettleFramesLeft > 0 || !ImGui::GetDrawData()) {
+            return true;
+        }
+
+        std::chrono::duration<float> idleTime = std::chrono::steady_clock::now() - context->m_LastBuiltFrame;
+        return idleTime.count() >= context->m_MaxIdleInterval;
+    }
+
+    // widgets being interacted with or animating on their own keep the UI awake even without new input
+    static bool ImGui_IsUIAnimating(ImGui_RiftContext *context) {
+        ImGuiContext &g = *context->m_Context;
+
+        if (ImGui::IsAnyItemActive() || ImGui::IsAnyMouseDown() || g.IO.WantTextInput ||
+            g.NavWindowingTimer > 0.f || g.DragDropActive) {
+            return true;
         }
 
-        ImGui::SetCurrentContext(g_ImGuiContext);
+        // delayed hovers and tooltips only show once their timers pass the style's delays, which takes frames
+        const ImGuiStyle &style = g.Style;
+        bool hovered = g.HoveredId != 0 || g.HoverItemDelayId != 0;
+
+        if ((g.HoveredId != 0 && g.HoveredIdTimer < style.HoverDelayNormal) ||
+            (g.HoverItemDelayId != 0 && g.HoverItemDelayTimer < style.HoverDelayNormal) ||
+            (hovered && g.MouseStationaryTimer < style.HoverStationaryDelay)) {
+            return true;
+        }
+
+        // the background behind modals fades in and out
+        return g.DimBgRatio > 0.f && g.DimBgRatio < 1.f;
+    }
+
+    static ImGui_AllocatorStats ImGui_RecordAllocatorFrame() {
+        std::lock_guard lock(g_AllocStatsLock);
+
+        ImGui_AllocatorCounters counters;
+        ImGui_Allocator_GetCounters(counters);
+
+        const auto &last = g_AllocCounters;
+        auto &frame = g_AllocFrame;
+
+        frame.FrameAllocationCount = (uint32_t) (counters.m_AllocationCount - last.m_AllocationCount);
+        frame.FrameFreeCount = (uint32_t) (counters.m_FreeCount - last.m_FreeCount);
+        frame.FrameAllocatedBytes = (size_t) (counters.m_AllocatedBytes - last.m_AllocatedBytes);
+        frame.BytesInUse = (size_t) counters.m_BytesInUse;
+        frame.PeakBytesInUse = (size_t) counters.m_PeakBytesInUse;
+        frame.ReservedBytes = (size_t) counters.m_ReservedBytes;
+        frame.TotalAllocationCount = counters.m_AllocationCount;
+        frame.LargeAllocationCount = counters.m_LargeAllocationCount;
+
+        g_AllocCounters = counters;
+        return frame;
+    }
+
+    static void ImGui_RecordProfilerFrame(ImGui_RiftContext *context, const ImGui_AllocatorStats &allocFrame) {
+        auto &frame = context->m_ProfilerFrame;
+        const auto &lists = ImGui_ImplEngine_GetListStats();
+
+        frame.VertexCount = 0;
+        frame.IndexCount = 0;
+        frame.CommandCount = 0;
+        frame.SubmitCount = 0;
+        frame.WindowCount = (uint32_t) lists.size();
+        frame.AllocationCount = allocFrame.FrameAllocationCount;
+        frame.AllocatedBytes = allocFrame.FrameAllocatedBytes;
+        frame.BytesInUse = allocFrame.BytesInUse;
+
+        for (size_t i = 0; i < lists.size(); i++) {
+            const auto &list = lists[i];
+
+            frame.VertexCount += list.m_VtxCount;
+            frame.IndexCount += list.m_IdxCount;
+            frame.CommandCount += list.m_CmdCount;
+            frame.SubmitCount += list.m_SubmitCount;
+
+            if (i < ImGui_ProfilerFrame::MAX_WINDOWS) {
+                auto &window = frame.Windows[i];
+
+                snprintf(window.Name, sizeof(window.Name), "%s", list.m_Name ? list.m_Name : "?");
+                window.VertexCount = list.m_VtxCount;
+                window.IndexCount = list.m_IdxCount;
+                window.CommandCount = list.m_CmdCount;
+                window.SubmitCount = list.m_SubmitCount;
+            }
+        }
+
+        context->m_Profiler.Record(frame);
+    }
+
+    bool ImGui_BeginFrame(ImGui_ContextHandle context) {
+        if (!context) {
+            return false;
+        }
+
+        auto beginTime = std::chrono::steady_clock::now();
+        auto &timing = context->m_CurrentTiming;
+        auto &profilerFrame = context->m_ProfilerFrame;
+
+        timing = {};
+        profilerFrame.Idle = false;
+        profilerFrame.NewFrameMs = 0.f;
+        profilerFrame.WidgetsMs = 0.f;
+        profilerFrame.RenderMs = 0.f;
+
+        ImGui::SetCurrentContext(context->m_Context);
+
+        context->m_FrameIdle = !ImGui_ShouldBuildFrame(context);
+
+        if (context->m_FrameIdle) {
+            context->m_IdleFrameCount++;
+            timing.Idle = true;
+            profilerFrame.Idle = true;
+            timing.BeginFrameMs = ImGui_ElapsedMs(beginTime);
+            return false;
+        }
+
+        context->m_LastBuiltFrame = std::chrono::steady_clock::now();
+        context->m_AppDirty = false;
+
         ImGui_ImplEngine_NewFrame();
+
+        auto newFrameTime = std::chrono::steady_clock::now();
         ImGui::NewFrame();
+        profilerFrame.NewFrameMs = ImGui_ElapsedMs(newFrameTime);
 
-        ImGui::ShowDemoWindow();
+        context->m_WidgetsStart = std::chrono::steady_clock::now();
+
+        if (context == g_DefaultContext && !(ImGui_ImplEngine_GetFlags() & ImGui_RiftFlags_HideDemoWindow)) {
+            ImGui::ShowDemoWindow();
+        }
+
+        timing.DeltaTime = ImGui::GetIO().DeltaTime;
+        timing.BeginFrameMs = ImGui_ElapsedMs(beginTime);
+
+        return true;
     }
 
-    void ImGui_EndFrame() {
-        ImGui::Render();
+    void ImGui_EndFrame(ImGui_ContextHandle context) {
+        if (!context) {
+            return;
+        }
+
+        auto endTime = std::chrono::steady_clock::now();
+        auto &timing = context->m_CurrentTiming;
+        auto &profilerFrame = context->m_ProfilerFrame;
+
+        ImGui::SetCurrentContext(context->m_Context);
+
+        ImGui_RiftFlags flags = ImGui_ImplEngine_GetFlags();
+
+        if (flags & ImGui_RiftFlags_ProfilerOverlay) {
+            flags |= ImGui_RiftFlags_Profiler;
+        }
+
+        // an idle frame presents the draw data of the last built frame again
+        if (!context->m_FrameIdle) {
+            profilerFrame.WidgetsMs = ImGui_ElapsedMs(context->m_WidgetsStart);
+
+            if (flags & ImGui_RiftFlags_ProfilerOverlay) {
+                context->m_Profiler.DrawOverlay();
+            }
+
+            auto renderStart = std::chrono::steady_clock::now();
+            ImGui::Render();
+            profilerFrame.RenderMs = ImGui_ElapsedMs(renderStart);
+
+            if (ImGui_IsUIAnimating(context)) {
+                context->m_SettleFramesLeft = IDLE_SETTLE_FRAMES;
+            } else if (context->m_SettleFramesLeft > 0) {
+                context->m_SettleFramesLeft--;
+            }
+        }
+
+        auto renderTime = std::chrono::steady_clock::now();
         ImGui_ImplEngine_RenderDrawData(ImGui::GetDrawData());
+        ImGui_ImplEngine_RenderPlatformWindows(!context->m_FrameIdle);
+
+        timing.RenderDrawDataMs = ImGui_ElapsedMs(renderTime);
+        timing.EndFrameMs = ImGui_ElapsedMs(endTime);
+
+        ImGui_AllocatorStats allocFrame = ImGui_RecordAllocatorFrame();
+
+        if (flags & ImGui_RiftFlags_Profiler) {
+            profilerFrame.RenderDrawDataMs = timing.RenderDrawDataMs;
+            ImGui_RecordProfilerFrame(context, allocFrame);
+        }
+
+        context->m_FrameTimings[context->m_FrameTimingHead] = timing;
+        context->m_FrameTimingHead = (context->m_FrameTimingHead + 1) % FRAME_TIMING_HISTORY;
+
+        if (context->m_FrameTimingCount < FRAME_TIMING_HISTORY) {
+            context->m_FrameTimingCount++;
+        }
     }
 
-    void ImGui_Initialize(engine::core::runtime::graphics::IGraphicsContext* gContext, core::runtime::graphics::IRenderer* renderer) {
-        g_ImGuiContext = ImGui::CreateContext();
-        ImGui::SetCurrentContext(g_ImGuiContext);
+    bool ImGui_BeginFrame() {
+        return ImGui_BeginFrame(g_DefaultContext);
+    }
+
+    void ImGui_EndFrame() {
+        ImGui_EndFrame(g_DefaultContext);
+    }
+
+    int ImGui_GetFrameTimings(ImGui_ContextHandle context, ImGui_FrameTiming *timings, int maxCount) {
+        if (!context) {
+            return 0;
+        }
+
+        int count = maxCount < context->m_FrameTimingCount ? maxCount : context->m_FrameTimingCount;
+        int first = context->m_FrameTimingHead - count;
+
+        if (first < 0) {
+            first += FRAME_TIMING_HISTORY;
+        }
+
+        for (int i = 0; i < count; i++) {
+            timings[i] = context->m_FrameTimings[(first + i) % FRAME_TIMING_HISTORY];
+        }
+
+        return count;
+    }
+
+    int ImGui_GetFrameTimings(ImGui_FrameTiming *timings, int maxCount) {
+        return ImGui_GetFrameTimings(g_DefaultContext, timings, maxCount);
+    }
+
+    void ImGui_RequestGlyphs(ImGui_ContextHandle context, const char *text) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_RequestGlyphs(ImGui::GetIO().Fonts, text);
+    }
+
+    void ImGui_RequestGlyphs(const char *text) {
+        ImGui_RequestGlyphs(g_DefaultContext, text);
+    }
+
+    void ImGui_RemapKey(const char *engineKey, ImGuiKey key) {
+        // engine key handles are the FNV hash of the key name
+        ImGui_ImplEngine_SetKeyMapping(engine::FNVConstHash(engineKey), {key, ImGuiMouseButton_COUNT});
+    }
+
+    void ImGui_RemapMouseButton(const char *engineKey, ImGuiMouseButton button) {
+        ImGui_ImplEngine_SetKeyMapping(engine::FNVConstHash(engineKey), {ImGuiKey_None, button});
+    }
+
+    void ImGui_ResetKeyMappings() {
+        ImGui_ImplEngine_ResetKeyMappings();
+    }
+
+    ImGui_TextureHandle ImGui_CreateTexture(ImGui_ContextHandle context, int width, int height,
+                                            const core::runtime::graphics::Color *pixels) {
+        if (!context) {
+            return nullptr;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        return ImGui_ImplEngine_GetTextureRegistry().Create(width, height, pixels);
+    }
+
+    ImGui_TextureHandle ImGui_CreateTexture(int width, int height, const core::runtime::graphics::Color *pixels) {
+        return ImGui_CreateTexture(g_DefaultContext, width, height, pixels);
+    }
+
+    void ImGui_AddTextureRef(ImGui_TextureHandle texture) {
+        if (texture) {
+            texture->m_Registry->AddRef(texture);
+        }
+    }
+
+    void ImGui_ReleaseTexture(ImGui_TextureHandle texture) {
+        if (texture) {
+            texture->m_Registry->Release(texture);
+        }
+    }
+
+    bool ImGui_UpdateTexture(ImGui_TextureHandle texture, int x, int y, int width, int height,
+                             const core::runtime::graphics::Color *pixels, int stride) {
+        return texture && pixels && texture->m_Registry->Update(texture, x, y, width, height, pixels, stride);
+    }
+
+    ImTextureID ImGui_GetTextureID(ImGui_TextureHandle texture) {
+        return texture ? texture->m_Registry->Use(texture) : (ImTextureID) nullptr;
+    }
+
+    void ImGui_SetTextureBudget(ImGui_ContextHandle context, size_t bytes) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_GetTextureRegistry().SetBudget(bytes);
+    }
+
+    void ImGui_SetTextureBudget(size_t bytes) {
+        ImGui_SetTextureBudget(g_DefaultContext, bytes);
+    }
+
+    ImGui_TouchGesture ImGui_GetTouchGesture(ImGui_ContextHandle context) {
+        ImGui_TouchGesture gesture;
+
+        if (context) {
+            ImGui::SetCurrentContext(context->m_Context);
+            ImGui_ImplEngine_GetTouchGesture(gesture);
+        }
+
+        return gesture;
+    }
+
+    ImGui_TouchGesture ImGui_GetTouchGesture() {
+        return ImGui_GetTouchGesture(g_DefaultContext);
+    }
+
+    bool ImGui_GetProfilerFrame(ImGui_ContextHandle context, int framesAgo, ImGui_ProfilerFrame &frame) {
+        return context && context->m_Profiler.Read(framesAgo, frame);
+    }
+
+    bool ImGui_GetProfilerFrame(int framesAgo, ImGui_ProfilerFrame &frame) {
+        return ImGui_GetProfilerFrame(g_DefaultContext, framesAgo, frame);
+    }
+
+    void ImGui_SetFrameClock(ImGui_ContextHandle context, ImGui_FrameClockFn clock) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_SetFrameClock(clock);
+    }
+
+    void ImGui_SetFrameClock(ImGui_FrameClockFn clock) {
+        ImGui_SetFrameClock(g_DefaultContext, clock);
+    }
+
+    void ImGui_MarkDirty(ImGui_ContextHandle context) {
+        if (context) {
+            context->m_AppDirty = true;
+        }
+    }
+
+    void ImGui_MarkDirty() {
+        ImGui_MarkDirty(g_DefaultContext);
+    }
+
+    void ImGui_SetMaxIdleInterval(ImGui_ContextHandle context, float seconds) {
+        if (context) {
+            context->m_MaxIdleInterval = seconds;
+        }
+    }
+
+    void ImGui_SetMaxIdleInterval(float seconds) {
+        ImGui_SetMaxIdleInterval(g_DefaultContext, seconds);
+    }
+
+    ImGui_ContextHandle ImGui_CreateContext(core::runtime::graphics::IGraphicsContext *gContext,
+                                            core::runtime::graphics::IRenderer *renderer,
+                                            ImGui_ContextHandle shareFontsWith) {
+        // ImGui frees through whatever allocator is installed at the time, so switching has to precede any allocation
+        if (g_PoolAllocatorEnabled) {
+            ImGui_Allocator_Install();
+        }
+
+        auto context = IM_NEW(ImGui_RiftContext)();
+
+        if (shareFontsWith) {
+            context->m_FontOwner = shareFontsWith->m_FontOwner ? shareFontsWith->m_FontOwner : shareFontsWith;
+            context->m_FontOwner->m_FontSharers++;
+        }
+
+        context->m_Context = ImGui::CreateContext(
+                context->m_FontOwner ? context->m_FontOwner->m_Context->IO.Fonts : nullptr);
+        ImGui::SetCurrentContext(context->m_Context);
 
         ImGuiIO &io = ImGui::GetIO();
 
-        ImFontConfig fontConfig;
-        fontConfig.OversampleH = 2;
-        fontConfig.OversampleV = 2;
+        // a shared atlas is already built, with whatever fonts its owner added
+        if (!context->m_FontOwner) {
+            ImFontConfig fontConfig;
+            fontConfig.OversampleH = 2;
+            fontConfig.OversampleV = 2;
+
+            ImGui_AddFont(context, "Engine/Fonts/Lexend.ttf", 16.0f, &fontConfig);
+            ImGui_AddFont(context, "Engine/Fonts/SourceCodePro.ttf", 14.0f, &fontConfig);
 
-        io.Fonts->AddFontFromFileTTF("DataRaw/Engine/Fonts/Lexend.ttf", 16.0f, &fontConfig);
-        io.Fonts->AddFontFromFileTTF("DataRaw/Engine/Fonts/SourceCodePro.ttf", 14.0f, &fontConfig);
+            // rasterizing the fonts dominates startup; reuse the atlas of a previous run when nothing changed
+            const char* cachePath = ImGui_GetFontAtlasCachePath();
+
+            if (!cachePath || !ImGui_FontCache_Load(io.Fonts, cachePath)) {
+                io.Fonts->Build();
+                ImGui_FontCache_Save(io.Fonts, cachePath);
+            }
+        }
 
         ImGui::GetStyle().FrameRounding = 3.0f;
         auto colors = ImGui::GetStyle().Colors;
@@ -48,12 +528,239 @@ namespace engine::ui {
         colors[ImGuiCol_ButtonActive] = ImVec4(0.11f, 0.50f, 1.00f, 1.00f);
 
         ImGui_ImplEngine_Init(gContext, renderer);
+
+        return context;
+    }
+
+    void ImGui_DestroyContext(ImGui_ContextHandle context) {
+        if (!context) {
+            return;
+        }
+
+        IM_ASSERT(context->m_FontSharers == 0 && "Destroy the contexts sharing this context's fonts first!");
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_Shutdown();
+        ImGui::DestroyContext(context->m_Context);
+
+        if (context->m_FontOwner) {
+            context->m_FontOwner->m_FontSharers--;
+        }
+
+        if (context == g_DefaultContext) {
+            g_DefaultContext = nullptr;
+        }
+
+        // only safe once the atlas referencing the mapped fonts is gone
+        IM_DELETE(context);
+    }
+
+    ImGui_ContextHandle ImGui_GetDefaultContext() {
+        return g_DefaultContext;
+    }
+
+    ImGuiContext *ImGui_GetImGuiContext(ImGui_ContextHandle context) {
+        return context ? context->m_Context : nullptr;
+    }
+
+    void ImGui_SetInputFocus(ImGui_ContextHandle context) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_SetInputFocus();
+    }
+
+    bool ImGui_EnableViewports(ImGui_ContextHandle context, const ImGui_ViewportWindowHooks &hooks) {
+        if (!context) {
+            return false;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        return ImGui_ImplEngine_EnableViewports(hooks);
+    }
+
+    bool ImGui_EnableViewports(const ImGui_ViewportWindowHooks &hooks) {
+        return ImGui_EnableViewports(g_DefaultContext, hooks);
+    }
+
+    void ImGui_Initialize(engine::core::runtime::graphics::IGraphicsContext* gContext, core::runtime::graphics::IRenderer* renderer) {
+        IM_ASSERT(g_DefaultContext == nullptr && "Already initialized!");
+        g_DefaultContext = ImGui_CreateContext(gContext, renderer);
     }
 
     void ImGui_Shutdown() {
+        ImGui_DestroyContext(g_DefaultContext);
+    }
+
+    void ImGui_SetAssetRoot(const char* root) {
+        g_AssetRoot = root;
+    }
+
+    ImFont* ImGui_AddFontFromMemory(ImGui_ContextHandle context, const void* data, size_t size, float sizePixels,
+                                    const ImFontConfig* config) {
+        if (!context) {
+            return nullptr;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGuiIO &io = ImGui::GetIO();
+
+        ImFontConfig fontConfig = config ? *config : ImFontConfig();
+        // stb_truetype only ever reads the font, so the atlas can use the caller's memory as is
+        fontConfig.FontDataOwnedByAtlas = false;
+
+        ImFont* font = io.Fonts->AddFontFromMemoryTTF(const_cast<void*>(data), (int) size, sizePixels, &fontConfig);
+
+        // fonts added once the backend is running need the atlas rebuilt before the next frame
+        if (font && io.BackendRendererUserData) {
+            ImGui_ImplEngine_InvalidateFontAtlas();
+        }
+
+        return font;
+    }
+
+    ImFont* ImGui_AddFontFromMemory(const void* data, size_t size, float sizePixels, const ImFontConfig* config) {
+        return ImGui_AddFontFromMemory(g_DefaultContext, data, size, sizePixels, config);
+    }
+
+    ImFont* ImGui_AddFont(ImGui_ContextHandle context, const char* bundlePath, float sizePixels,
+                          const ImFontConfig* config) {
+        if (!context) {
+            return nullptr;
+        }
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s%s", g_AssetRoot, bundlePath);
+
+        auto file = std::make_unique<ImGui_MappedFile>();
+
+        if (!file->Open(path)) {
+            IM_ASSERT(false && "Could not map font file!");
+            return nullptr;
+        }
+
+        ImFontConfig fontConfig = config ? *config : ImFontConfig();
+
+        if (!fontConfig.Name[0]) {
+            const char* fileName = strrchr(bundlePath, '/');
+            snprintf(fontConfig.Name, sizeof(fontConfig.Name), "%s, %.0fpx", fileName ? fileName + 1 : bundlePath, sizePixels);
+        }
+
+        ImFont* font = ImGui_AddFontFromMemory(context, file->GetData(), file->GetSize(), sizePixels, &fontConfig);
+
+        // the mapping has to live as long as the atlas, which belongs to the context that created it
+        if (font) {
+            auto owner = context->m_FontOwner ? context->m_FontOwner : context;
+            owner->m_FontFiles.push_back(std::move(file));
+        }
+
+        return font;
+    }
+
+    ImFont* ImGui_AddFont(const char* bundlePath, float sizePixels, const ImFontConfig* config) {
+        return ImGui_AddFont(g_DefaultContext, bundlePath, sizePixels, config);
+    }
+
+    void ImGui_SetFontAtlasCachePath(const char* path) {
+        g_FontAtlasCachePath = path;
+        g_FontAtlasCacheDisabled = !path;
     }
 
     ImGuiContext* ImGui_GetGlobalContext() {
-        return g_ImGuiContext;
+        return ImGui_GetImGuiContext(g_DefaultContext);
+    }
+
+    ImGui_RenderStats ImGui_GetRenderStats(ImGui_ContextHandle context) {
+        ImGui_RenderStats stats;
+
+        if (context) {
+            stats.IdleFrameCount = context->m_IdleFrameCount;
+
+            ImGui::SetCurrentContext(context->m_Context);
+            ImGui_ImplEngine_GetRenderStats(stats);
+        }
+
+        return stats;
+    }
+
+    ImGui_RenderStats ImGui_GetRenderStats() {
+        return ImGui_GetRenderStats(g_DefaultContext);
+    }
+
+    ImGui_AllocatorStats ImGui_GetAllocatorStats() {
+        std::lock_guard lock(g_AllocStatsLock);
+        return g_AllocFrame;
+    }
+
+    bool ImGui_StartCapture(ImGui_ContextHandle context, const char *path) {
+        if (!context) {
+            return false;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        return ImGui_ImplEngine_StartCapture(path);
+    }
+
+    bool ImGui_StartCapture(const char *path) {
+        return ImGui_StartCapture(g_DefaultContext, path);
+    }
+
+    void ImGui_StopCapture(ImGui_ContextHandle context) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_StopCapture();
+    }
+
+    void ImGui_StopCapture() {
+        ImGui_StopCapture(g_DefaultContext);
+    }
+
+    void ImGui_SetPoolAllocatorEnabled(bool enabled) {
+        IM_ASSERT(!ImGui_Allocator_IsInstalled() && "The pool allocator is already in use by a context!");
+        g_PoolAllocatorEnabled = enabled;
+    }
+
+    void ImGui_SetFlags(ImGui_ContextHandle context, ImGui_RiftFlags flags) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_SetFlags(flags);
+    }
+
+    void ImGui_SetFlags(ImGui_RiftFlags flags) {
+        ImGui_SetFlags(g_DefaultContext, flags);
+    }
+
+    ImGui_RiftFlags ImGui_GetFlags(ImGui_ContextHandle context) {
+        if (!context) {
+            return ImGui_RiftFlags_None;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        return ImGui_ImplEngine_GetFlags();
+    }
+
+    ImGui_RiftFlags ImGui_GetFlags() {
+        return ImGui_GetFlags(g_DefaultContext);
+    }
+
+    void ImGui_SetParallelConversionThreshold(ImGui_ContextHandle context, uint32_t vertexCount) {
+        if (!context) {
+            return;
+        }
+
+        ImGui::SetCurrentContext(context->m_Context);
+        ImGui_ImplEngine_SetParallelThreshold(vertexCount);
+    }
+
+    void ImGui_SetParallelConversionThreshold(uint32_t vertexCount) {
+        ImGui_SetParallelConversionThreshold(g_DefaultContext, vertexCount);
     }
-}
\ No newline at end of file
+}
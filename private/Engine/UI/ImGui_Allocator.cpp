@@ -0,0 +1,177 @@
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+#include <Engine/UI/ImGui_Allocator.hpp>
+
+#include <imgui.h>
+
+namespace engine::ui {
+    // payload sizes; every one a multiple of 16 so blocks keep malloc's alignment behind their header
+    static constexpr uint32_t g_ClassSizes[] = {
+            16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192
+    };
+    static constexpr int CLASS_COUNT = sizeof(g_ClassSizes) / sizeof(g_ClassSizes[0]);
+    static constexpr uint32_t MAX_CLASS_SIZE = g_ClassSizes[CLASS_COUNT - 1];
+    static constexpr uint32_t LARGE_CLASS = 0xFFFFFFFF;
+    static constexpr size_t SLAB_SIZE = 64 * 1024;
+
+    // in front of every block; remembers where a block goes back to, as ImGui frees without a size
+    struct alignas(16) ImGui_AllocHeader {
+        uint32_t m_Class;
+        // requested size, for the in-use statistics
+        uint64_t m_Size;
+    };
+
+    static_assert(sizeof(ImGui_AllocHeader) == 16, "Allocation header has to keep 16-byte alignment!");
+
+    struct ImGui_FreeBlock {
+        ImGui_FreeBlock *m_Next;
+    };
+
+    struct ImGui_SizeClass {
+        std::mutex m_Lock;
+        ImGui_FreeBlock *m_Free = nullptr;
+    };
+
+    // one entry per 16 bytes of requested size
+    static constexpr auto g_ClassLookup = []() {
+        std::array<uint8_t, MAX_CLASS_SIZE / 16 + 1> lookup{};
+
+        for (uint32_t i = 0, cls = 0; i < lookup.size(); i++) {
+            while (g_ClassSizes[cls] < i * 16) {
+                cls++;
+            }
+
+            lookup[i] = (uint8_t) cls;
+        }
+
+        return lookup;
+    }();
+
+    static ImGui_SizeClass g_SizeClasses[CLASS_COUNT];
+    static bool g_Installed = false;
+
+    static std::atomic<uint64_t> g_AllocationCount = 0;
+    static std::atomic<uint64_t> g_FreeCount = 0;
+    static std::atomic<uint64_t> g_AllocatedBytes = 0;
+    static std::atomic<uint64_t> g_BytesInUse = 0;
+    static std::atomic<uint64_t> g_PeakBytesInUse = 0;
+    static std::atomic<uint64_t> g_ReservedBytes = 0;
+    static std::atomic<uint64_t> g_LargeAllocationCount = 0;
+
+    // carves a new slab into blocks of the class; caller holds the class lock
+    static bool ImGui_Allocator_Refill(ImGui_SizeClass &sizeClass, uint32_t classSize) {
+        auto slab = (uint8_t *) malloc(SLAB_SIZE);
+
+        if (!slab) {
+            return false;
+        }
+
+        g_ReservedBytes.fetch_add(SLAB_SIZE, std::memory_order_relaxed);
+
+        size_t blockSize = sizeof(ImGui_AllocHeader) + classSize;
+
+        for (size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize) {
+            auto block = (ImGui_FreeBlock *) (slab + offset);
+            block->m_Next = sizeClass.m_Free;
+            sizeClass.m_Free = block;
+        }
+
+        return true;
+    }
+
+    static void ImGui_Allocator_TrackAlloc(size_t size) {
+        g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        g_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        uint64_t inUse = g_BytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+        uint64_t peak = g_PeakBytesInUse.load(std::memory_order_relaxed);
+
+        while (inUse > peak && !g_PeakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void *ImGui_Allocator_Alloc(size_t size, void *) {
+        ImGui_AllocHeader *header;
+
+        if (size > MAX_CLASS_SIZE) {
+            header = (ImGui_AllocHeader *) malloc(sizeof(ImGui_AllocHeader) + size);
+
+            if (!header) {
+                return nullptr;
+            }
+
+            header->m_Class = LARGE_CLASS;
+            g_ReservedBytes.fetch_add(sizeof(ImGui_AllocHeader) + size, std::memory_order_relaxed);
+            g_LargeAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            uint32_t cls = g_ClassLookup[(size + 15) / 16];
+            auto &sizeClass = g_SizeClasses[cls];
+
+            std::lock_guard lock(sizeClass.m_Lock);
+
+            if (!sizeClass.m_Free && !ImGui_Allocator_Refill(sizeClass, g_ClassSizes[cls])) {
+                return nullptr;
+            }
+
+            header = (ImGui_AllocHeader *) sizeClass.m_Free;
+            sizeClass.m_Free = sizeClass.m_Free->m_Next;
+            header->m_Class = cls;
+        }
+
+        header->m_Size = size;
+        ImGui_Allocator_TrackAlloc(size);
+
+        return header + 1;
+    }
+
+    static void ImGui_Allocator_Free(void *ptr, void *) {
+        if (!ptr) {
+            return;
+        }
+
+        auto header = (ImGui_AllocHeader *) ptr - 1;
+        uint64_t size = header->m_Size;
+
+        g_FreeCount.fetch_add(1, std::memory_order_relaxed);
+        g_BytesInUse.fetch_sub(size, std::memory_order_relaxed);
+
+        if (header->m_Class == LARGE_CLASS) {
+            g_ReservedBytes.fetch_sub(sizeof(ImGui_AllocHeader) + size, std::memory_order_relaxed);
+            free(header);
+            return;
+        }
+
+        auto &sizeClass = g_SizeClasses[header->m_Class];
+        auto block = (ImGui_FreeBlock *) header;
+
+        std::lock_guard lock(sizeClass.m_Lock);
+        block->m_Next = sizeClass.m_Free;
+        sizeClass.m_Free = block;
+    }
+
+    void ImGui_Allocator_Install() {
+        if (g_Installed) {
+            return;
+        }
+
+        ImGui::SetAllocatorFunctions(ImGui_Allocator_Alloc, ImGui_Allocator_Free);
+        g_Installed = true;
+    }
+
+    bool ImGui_Allocator_IsInstalled() {
+        return g_Installed;
+    }
+
+    void ImGui_Allocator_GetCounters(ImGui_AllocatorCounters &counters) {
+        counters.m_AllocationCount = g_AllocationCount.load(std::memory_order_relaxed);
+        counters.m_FreeCount = g_FreeCount.load(std::memory_order_relaxed);
+        counters.m_AllocatedBytes = g_AllocatedBytes.load(std::memory_order_relaxed);
+        counters.m_BytesInUse = g_BytesInUse.load(std::memory_order_relaxed);
+        counters.m_PeakBytesInUse = g_PeakBytesInUse.load(std::memory_order_relaxed);
+        counters.m_ReservedBytes = g_ReservedBytes.load(std::memory_order_relaxed);
+        counters.m_LargeAllocationCount = g_LargeAllocationCount.load(std::memory_order_relaxed);
+    }
+}
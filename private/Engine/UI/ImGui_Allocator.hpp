@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::ui {
+    // running totals of the pool allocator; every field only ever grows except the in-use ones
+    struct ImGui_AllocatorCounters {
+        uint64_t m_AllocationCount;
+        uint64_t m_FreeCount;
+        uint64_t m_AllocatedBytes;
+        uint64_t m_BytesInUse;
+        uint64_t m_PeakBytesInUse;
+        // slabs taken from the system heap plus live allocations too large for a size class
+        uint64_t m_ReservedBytes;
+        uint64_t m_LargeAllocationCount;
+    };
+
+    // hands ImGui::SetAllocatorFunctions a size-class pool: small blocks come from per-class free lists carved out of
+    // slabs that are kept for reuse, so steady-state frames never reach the system heap. process-wide, like ImGui's
+    // allocator itself; installing it once any ImGui memory is live would free that memory into the wrong allocator
+    extern void ImGui_Allocator_Install();
+    extern bool ImGui_Allocator_IsInstalled();
+
+    extern void ImGui_Allocator_GetCounters(ImGui_AllocatorCounters &counters);
+}
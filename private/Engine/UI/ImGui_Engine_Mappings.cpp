@@ -1,144 +1,172 @@
 #include <Engine/UI/ImGui_Engine_Mappings.hpp>
 
-#include <Engine/Input/InputKeyRepository.hpp>
 #include <Engine/Core/Hashing/FNV.hpp>
 
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+
 namespace engine::ui {
-    ImGuiMouseButton ImGui_ImplEngine_MapInputDeviceButton(input::InputKeyHandle key) {
-        switch (key) {
-            case engine::FNVConstHash("Mouse_Left"):
-                return ImGuiMouseButton_Left;
-            case engine::FNVConstHash("Mouse_Right"):
-                return ImGuiMouseButton_Right;
-            case engine::FNVConstHash("Mouse_Middle"):
-                return ImGuiMouseButton_Middle;
-            default:
-                return ImGuiMouseButton_COUNT;
+    // open addressing over a power of two; ~130 default keys keep the load factor around 25%
+    static constexpr uint32_t IMGUI_KEY_TABLE_SIZE = 512;
+
+    struct ImGui_ImplEngine_KeySlot {
+        input::InputKeyHandle m_Handle = 0;
+        ImGui_ImplEngine_KeyMapping m_Mapping;
+        bool m_Used = false;
+    };
+
+    struct ImGui_ImplEngine_KeyTable {
+        ImGui_ImplEngine_KeySlot m_Slots[IMGUI_KEY_TABLE_SIZE];
+        uint32_t m_Count = 0;
+
+        ImGui_ImplEngine_KeySlot *Find(input::InputKeyHandle key) {
+            // handles are already FNV hashes, but their low bits are weak; fold the high bits in first
+            uint32_t idx = (key ^ (key >> 16)) & (IMGUI_KEY_TABLE_SIZE - 1);
+
+            while (m_Slots[idx].m_Used && m_Slots[idx].m_Handle != key) {
+                idx = (idx + 1) & (IMGUI_KEY_TABLE_SIZE - 1);
+            }
+
+            return &m_Slots[idx];
+        }
+
+        void Set(input::InputKeyHandle key, ImGui_ImplEngine_KeyMapping mapping) {
+            auto slot = Find(key);
+
+            if (!slot->m_Used) {
+                IM_ASSERT(m_Count < IMGUI_KEY_TABLE_SIZE / 2 && "Too many key mappings!");
+                slot->m_Used = true;
+                slot->m_Handle = key;
+                m_Count++;
+            }
+
+            slot->m_Mapping = mapping;
+        }
+
+        void SetKey(const char *name, ImGuiKey key) {
+            Set(engine::FNVConstHash(name), {key, ImGuiMouseButton_COUNT});
+        }
+
+        void SetMouseButton(const char *name, ImGuiMouseButton button) {
+            Set(engine::FNVConstHash(name), {ImGuiKey_None, button});
+        }
+    };
+
+    static ImGui_ImplEngine_KeyTable ImGui_ImplEngine_BuildDefaultKeyTable() {
+        ImGui_ImplEngine_KeyTable table;
+
+        table.SetMouseButton("Mouse_Left", ImGuiMouseButton_Left);
+        table.SetMouseButton("Mouse_Right", ImGuiMouseButton_Right);
+        table.SetMouseButton("Mouse_Middle", ImGuiMouseButton_Middle);
+
+        table.SetKey("Key_Tab", ImGuiKey_Tab);
+        table.SetKey("Key_LeftArrow", ImGuiKey_LeftArrow);
+        table.SetKey("Key_RightArrow", ImGuiKey_RightArrow);
+        table.SetKey("Key_UpArrow", ImGuiKey_UpArrow);
+        table.SetKey("Key_DownArrow", ImGuiKey_DownArrow);
+        table.SetKey("Key_PageUp", ImGuiKey_PageUp);
+        table.SetKey("Key_PageDown", ImGuiKey_PageDown);
+        table.SetKey("Key_Home", ImGuiKey_Home);
+        table.SetKey("Key_End", ImGuiKey_End);
+        table.SetKey("Key_Insert", ImGuiKey_Insert);
+        table.SetKey("Key_Delete", ImGuiKey_Delete);
+        table.SetKey("Key_Backspace", ImGuiKey_Backspace);
+        table.SetKey("Key_Space", ImGuiKey_Space);
+        table.SetKey("Key_Enter", ImGuiKey_Enter);
+        table.SetKey("Key_Escape", ImGuiKey_Escape);
+        table.SetKey("Key_LeftCtrl", ImGuiKey_LeftCtrl);
+        table.SetKey("Key_LeftShift", ImGuiKey_LeftShift);
+        table.SetKey("Key_LeftAlt", ImGuiKey_LeftAlt);
+        table.SetKey("Key_LeftSuper", ImGuiKey_LeftSuper);
+        table.SetKey("Key_RightCtrl", ImGuiKey_RightCtrl);
+        table.SetKey("Key_RightShift", ImGuiKey_RightShift);
+        table.SetKey("Key_RightAlt", ImGuiKey_RightAlt);
+        table.SetKey("Key_RightSuper", ImGuiKey_RightSuper);
+        table.SetKey("Key_Menu", ImGuiKey_Menu);
+        table.SetKey("Key_Apostrophe", ImGuiKey_Apostrophe);
+        table.SetKey("Key_Comma", ImGuiKey_Comma);
+        table.SetKey("Key_Minus", ImGuiKey_Minus);
+        table.SetKey("Key_Period", ImGuiKey_Period);
+        table.SetKey("Key_Slash", ImGuiKey_Slash);
+        table.SetKey("Key_Semicolon", ImGuiKey_Semicolon);
+        table.SetKey("Key_Equal", ImGuiKey_Equal);
+        table.SetKey("Key_LeftBracket", ImGuiKey_LeftBracket);
+        table.SetKey("Key_Backslash", ImGuiKey_Backslash);
+        table.SetKey("Key_RightBracket", ImGuiKey_RightBracket);
+        table.SetKey("Key_GraveAccent", ImGuiKey_GraveAccent);
+        table.SetKey("Key_CapsLock", ImGuiKey_CapsLock);
+        table.SetKey("Key_ScrollLock", ImGuiKey_ScrollLock);
+        table.SetKey("Key_NumLock", ImGuiKey_NumLock);
+        table.SetKey("Key_PrintScreen", ImGuiKey_PrintScreen);
+        table.SetKey("Key_Pause", ImGuiKey_Pause);
+        table.SetKey("Key_KeypadDecimal", ImGuiKey_KeypadDecimal);
+        table.SetKey("Key_KeypadDivide", ImGuiKey_KeypadDivide);
+        table.SetKey("Key_KeypadMultiply", ImGuiKey_KeypadMultiply);
+        table.SetKey("Key_KeypadSubtract", ImGuiKey_KeypadSubtract);
+        table.SetKey("Key_KeypadAdd", ImGuiKey_KeypadAdd);
+        table.SetKey("Key_KeypadEnter", ImGuiKey_KeypadEnter);
+        table.SetKey("Key_KeypadEqual", ImGuiKey_KeypadEqual);
+
+        // the numbered keys follow a naming scheme, so generate their names once instead of listing them
+        char name[16];
+
+        for (int i = 0; i < 10; i++) {
+            snprintf(name, sizeof(name), "Key_%d", i);
+            table.SetKey(name, (ImGuiKey) (ImGuiKey_0 + i));
+
+            snprintf(name, sizeof(name), "Key_Keypad%d", i);
+            table.SetKey(name, (ImGuiKey) (ImGuiKey_Keypad0 + i));
         }
+
+        for (int i = 0; i < 26; i++) {
+            snprintf(name, sizeof(name), "Key_%c", 'A' + i);
+            table.SetKey(name, (ImGuiKey) (ImGuiKey_A + i));
+        }
+
+        for (int i = 1; i <= 24; i++) {
+            snprintf(name, sizeof(name), "Key_F%d", i);
+            table.SetKey(name, (ImGuiKey) (ImGuiKey_F1 + (i - 1)));
+        }
+
+        return table;
+    }
+
+    static const ImGui_ImplEngine_KeyTable &ImGui_ImplEngine_GetDefaultKeyTable() {
+        static const ImGui_ImplEngine_KeyTable defaultTable = ImGui_ImplEngine_BuildDefaultKeyTable();
+        return defaultTable;
+    }
+
+    static ImGui_ImplEngine_KeyTable &ImGui_ImplEngine_GetKeyTable() {
+        static ImGui_ImplEngine_KeyTable table = ImGui_ImplEngine_GetDefaultKeyTable();
+        return table;
+    }
+
+    // the table is shared by every context, which may be taking input on threads of their own while it is remapped
+    static std::shared_mutex g_KeyTableLock;
+
+    ImGui_ImplEngine_KeyMapping ImGui_ImplEngine_LookupKey(input::InputKeyHandle key) {
+        std::shared_lock lock(g_KeyTableLock);
+        return ImGui_ImplEngine_GetKeyTable().Find(key)->m_Mapping;
+    }
+
+    void ImGui_ImplEngine_SetKeyMapping(input::InputKeyHandle key, ImGui_ImplEngine_KeyMapping mapping) {
+        std::unique_lock lock(g_KeyTableLock);
+        ImGui_ImplEngine_GetKeyTable().Set(key, mapping);
+    }
+
+    void ImGui_ImplEngine_ResetKeyMappings() {
+        const auto &defaultTable = ImGui_ImplEngine_GetDefaultKeyTable();
+
+        std::unique_lock lock(g_KeyTableLock);
+        ImGui_ImplEngine_GetKeyTable() = defaultTable;
+    }
+
+    ImGuiMouseButton ImGui_ImplEngine_MapInputDeviceButton(input::InputKeyHandle key) {
+        return ImGui_ImplEngine_LookupKey(key).m_MouseButton;
     }
 
     ImGuiKey ImGui_ImplEngine_MapKey(input::InputKeyHandle key) {
-        switch (key) {
-            case engine::FNVConstHash("Key_Tab"):
-                return ImGuiKey_Tab;
-            case engine::FNVConstHash("Key_LeftArrow"):
-                return ImGuiKey_LeftArrow;
-            case engine::FNVConstHash("Key_RightArrow"):
-                return ImGuiKey_RightArrow;
-            case engine::FNVConstHash("Key_UpArrow"):
-                return ImGuiKey_UpArrow;
-            case engine::FNVConstHash("Key_DownArrow"):
-                return ImGuiKey_DownArrow;
-            case engine::FNVConstHash("Key_PageUp"):
-                return ImGuiKey_PageUp;
-            case engine::FNVConstHash("Key_PageDown"):
-                return ImGuiKey_PageDown;
-            case engine::FNVConstHash("Key_Home"):
-                return ImGuiKey_Home;
-            case engine::FNVConstHash("Key_End"):
-                return ImGuiKey_End;
-            case engine::FNVConstHash("Key_Insert"):
-                return ImGuiKey_Insert;
-            case engine::FNVConstHash("Key_Delete"):
-                return ImGuiKey_Delete;
-            case engine::FNVConstHash("Key_Backspace"):
-                return ImGuiKey_Backspace;
-            case engine::FNVConstHash("Key_Space"):
-                return ImGuiKey_Space;
-            case engine::FNVConstHash("Key_Enter"):
-                return ImGuiKey_Enter;
-            case engine::FNVConstHash("Key_Escape"):
-                return ImGuiKey_Escape;
-            case engine::FNVConstHash("Key_LeftCtrl"):
-                return ImGuiKey_LeftCtrl;
-            case engine::FNVConstHash("Key_LeftShift"):
-                return ImGuiKey_LeftShift;
-            case engine::FNVConstHash("Key_LeftAlt"):
-                return ImGuiKey_LeftAlt;
-            case engine::FNVConstHash("Key_LeftSuper"):
-                return ImGuiKey_LeftSuper;
-            case engine::FNVConstHash("Key_RightCtrl"):
-                return ImGuiKey_RightCtrl;
-            case engine::FNVConstHash("Key_RightShift"):
-                return ImGuiKey_RightShift;
-            case engine::FNVConstHash("Key_RightAlt"):
-                return ImGuiKey_RightAlt;
-            case engine::FNVConstHash("Key_RightSuper"):
-                return ImGuiKey_RightSuper;
-            case engine::FNVConstHash("Key_Menu"):
-                return ImGuiKey_Menu;
-            case engine::FNVConstHash("Key_Apostrophe"):
-                return ImGuiKey_Apostrophe;
-            case engine::FNVConstHash("Key_Comma"):
-                return ImGuiKey_Comma;
-            case engine::FNVConstHash("Key_Minus"):
-                return ImGuiKey_Minus;
-            case engine::FNVConstHash("Key_Period"):
-                return ImGuiKey_Period;
-            case engine::FNVConstHash("Key_Slash"):
-                return ImGuiKey_Slash;
-            case engine::FNVConstHash("Key_Semicolon"):
-                return ImGuiKey_Semicolon;
-            case engine::FNVConstHash("Key_Equal"):
-                return ImGuiKey_Equal;
-            case engine::FNVConstHash("Key_LeftBracket"):
-                return ImGuiKey_LeftBracket;
-            case engine::FNVConstHash("Key_Backslash"):
-                return ImGuiKey_Backslash;
-            case engine::FNVConstHash("Key_RightBracket"):
-                return ImGuiKey_RightBracket;
-            case engine::FNVConstHash("Key_GraveAccent"):
-                return ImGuiKey_GraveAccent;
-            case engine::FNVConstHash("Key_CapsLock"):
-                return ImGuiKey_CapsLock;
-            case engine::FNVConstHash("Key_ScrollLock"):
-                return ImGuiKey_ScrollLock;
-            case engine::FNVConstHash("Key_NumLock"):
-                return ImGuiKey_NumLock;
-            case engine::FNVConstHash("Key_PrintScreen"):
-                return ImGuiKey_PrintScreen;
-            case engine::FNVConstHash("Key_Pause"):
-                return ImGuiKey_Pause;
-            case engine::FNVConstHash("Key_KeypadDecimal"):
-                return ImGuiKey_KeypadDecimal;
-            case engine::FNVConstHash("Key_KeypadDivide"):
-                return ImGuiKey_KeypadDivide;
-            case engine::FNVConstHash("Key_KeypadMultiply"):
-                return ImGuiKey_KeypadMultiply;
-            case engine::FNVConstHash("Key_KeypadSubtract"):
-                return ImGuiKey_KeypadSubtract;
-            case engine::FNVConstHash("Key_KeypadAdd"):
-                return ImGuiKey_KeypadAdd;
-            case engine::FNVConstHash("Key_KeypadEnter"):
-                return ImGuiKey_KeypadEnter;
-            case engine::FNVConstHash("Key_KeypadEqual"):
-                return ImGuiKey_KeypadEqual;
-            default:
-                auto buttonName = input::InputKeyRepository::Instance().GetKey(key);
-
-                // smart trick to save up on if statements for numeric keys; we'll just calculate offsets for 0-9 and A-Z
-                if (buttonName.size() == 5 && buttonName.starts_with("Key_")) {
-                    char c = buttonName[4];
-                    if (c >= '0' && c <= '9') { return (ImGuiKey) (ImGuiKey_0 + (c - '0')); }
-                    if (c >= 'A' && c <= 'Z') { return (ImGuiKey) (ImGuiKey_A + (c - 'A')); }
-                }
-
-                // if it starts with "Key_F" then it must be a function key
-                else if (buttonName.starts_with("Key_F")) {
-                    int fKey = atoi(buttonName.data() + 5); // get the number after F
-                    if (fKey >= 1 && fKey <= 24) {
-                        return (ImGuiKey) (ImGuiKey_F1 + (fKey - 1)); // do some smart tricks again to calculate offsets!
-                    }
-                }
-
-                // if its a keypad key, we check it
-                else if (buttonName.starts_with("Key_Keypad")) {
-                    char c = buttonName[10]; // get the number after "Key_Keypad"
-                    if (c >= '0' && c <= '9') { return (ImGuiKey) (ImGuiKey_Keypad0 + (c - '0')); }
-                }
-
-                // invalid result by default.
-                return ImGuiKey_None;
-        }
+        return ImGui_ImplEngine_LookupKey(key).m_Key;
     }
-}
\ No newline at end of file
+}
@@ -4,6 +4,19 @@
 #include <Engine/UI/ImGui.hpp>
 
 namespace engine::ui {
+    // what a single engine key drives on the ImGui side; a key maps to a keyboard key, a mouse button or neither
+    struct ImGui_ImplEngine_KeyMapping {
+        ImGuiKey m_Key = ImGuiKey_None;
+        ImGuiMouseButton m_MouseButton = ImGuiMouseButton_COUNT;
+    };
+
+    // single hash table probe, no string work; safe to call for every input event. the table is shared by every
+    // context and may be remapped from any thread
+    extern ImGui_ImplEngine_KeyMapping ImGui_ImplEngine_LookupKey(input::InputKeyHandle key);
+    extern void ImGui_ImplEngine_SetKeyMapping(input::InputKeyHandle key, ImGui_ImplEngine_KeyMapping mapping);
+    // drops runtime remaps and goes back to the built-in table
+    extern void ImGui_ImplEngine_ResetKeyMappings();
+
     extern ImGuiMouseButton ImGui_ImplEngine_MapInputDeviceButton(input::InputKeyHandle key);
     extern ImGuiKey ImGui_ImplEngine_MapKey(input::InputKeyHandle key);
-}
\ No newline at end of file
+}
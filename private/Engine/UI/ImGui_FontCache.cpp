@@ -0,0 +1,269 @@
+#include <cstdio>
+#include <cstring>
+
+#include <Engine/UI/ImGui_FontCache.hpp>
+
+#include <Engine/UI/ImGui_MappedFile.hpp>
+
+#include <imgui_internal.h>
+
+namespace engine::ui {
+    static constexpr char FONT_CACHE_MAGIC[4] = {'R', 'F', 'A', 'C'};
+    static constexpr uint32_t FONT_CACHE_VERSION = 1;
+
+    struct ImGui_FontCache_Header {
+        char m_Magic[4];
+        uint32_t m_Version;
+        uint64_t m_Key;
+        uint32_t m_GlyphSize;
+        uint32_t m_FontCount;
+        int32_t m_TexWidth;
+        int32_t m_TexHeight;
+        ImVec2 m_TexUvScale;
+        ImVec2 m_TexUvWhitePixel;
+        uint32_t m_TexUvLineCount;
+        uint32_t m_TexPixelsUseColors;
+    };
+
+    struct ImGui_FontCache_Font {
+        float m_FontSize;
+        float m_Ascent;
+        float m_Descent;
+        int32_t m_MetricsTotalSurface;
+        uint32_t m_GlyphCount;
+    };
+
+    struct ImGui_FontCache_Reader {
+        const uint8_t *m_Cursor;
+        const uint8_t *m_End;
+
+        bool Read(void *dst, size_t size) {
+            if ((size_t) (m_End - m_Cursor) < size) {
+                return false;
+            }
+
+            memcpy(dst, m_Cursor, size);
+            m_Cursor += size;
+            return true;
+        }
+    };
+
+    static uint64_t ImGui_FontCache_Hash(const void *data, size_t size, uint64_t h) {
+        // FNV-1a; hashing the font sources is a fraction of what rasterizing them costs
+        auto bytes = (const uint8_t *) data;
+
+        for (size_t i = 0; i < size; i++) {
+            h = (h ^ bytes[i]) * 0x100000001B3ull;
+        }
+
+        return h;
+    }
+
+    // everything the atlas is built from: font sources, their configuration and the glyph ranges
+    static uint64_t ImGui_FontCache_ComputeKey(ImFontAtlas *atlas) {
+        uint64_t h = 0xCBF29CE484222325ull;
+
+        uint32_t version[2] = {FONT_CACHE_VERSION, IMGUI_VERSION_NUM};
+        h = ImGui_FontCache_Hash(version, sizeof(version), h);
+
+        int atlasConfig[3] = {atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding};
+        h = ImGui_FontCache_Hash(atlasConfig, sizeof(atlasConfig), h);
+
+        for (const auto &config: atlas->ConfigData) {
+            h = ImGui_FontCache_Hash(config.FontData, config.FontDataSize, h);
+
+            // settings are hashed as raw bytes with the pointers cleared; stale padding can only cause a rebuild
+            ImFontConfig settings = config;
+            settings.FontData = nullptr;
+            settings.GlyphRanges = nullptr;
+            settings.DstFont = nullptr;
+            h = ImGui_FontCache_Hash(&settings, sizeof(settings), h);
+
+            const ImWchar *ranges = config.GlyphRanges ? config.GlyphRanges : atlas->GetGlyphRangesDefault();
+
+            for (; ranges[0]; ranges += 2) {
+                h = ImGui_FontCache_Hash(ranges, sizeof(ImWchar) * 2, h);
+            }
+
+            for (int i = 0; i < atlas->Fonts.Size; i++) {
+                if (atlas->Fonts[i] == config.DstFont) {
+                    h = ImGui_FontCache_Hash(&i, sizeof(i), h);
+                }
+            }
+        }
+
+        return h;
+    }
+
+    bool ImGui_FontCache_Load(ImFontAtlas *atlas, const char *path) {
+        ImGui_MappedFile file;
+
+        if (!path || !file.Open(path)) {
+            return false;
+        }
+
+        ImGui_FontCache_Reader reader{file.GetData(), file.GetData() + file.GetSize()};
+        ImGui_FontCache_Header header{};
+
+        if (!reader.Read(&header, sizeof(header)) ||
+            memcmp(header.m_Magic, FONT_CACHE_MAGIC, sizeof(FONT_CACHE_MAGIC)) != 0 ||
+            header.m_Version != FONT_CACHE_VERSION ||
+            header.m_GlyphSize != sizeof(ImFontGlyph) ||
+            header.m_FontCount != (uint32_t) atlas->Fonts.Size ||
+            header.m_TexUvLineCount != IM_ARRAYSIZE(atlas->TexUvLines) ||
+            header.m_TexWidth <= 0 || header.m_TexHeight <= 0 ||
+            header.m_Key != ImGui_FontCache_ComputeKey(atlas)) {
+            return false;
+        }
+
+        ImVec4 uvLines[IM_ARRAYSIZE(atlas->TexUvLines)];
+
+        if (!reader.Read(uvLines, sizeof(uvLines))) {
+            return false;
+        }
+
+        // validate the whole file before touching the atlas, a truncated cache must leave it unbuilt
+        ImGui_FontCache_Reader validate = reader;
+
+        for (uint32_t i = 0; i < header.m_FontCount; i++) {
+            ImGui_FontCache_Font font{};
+
+            if (!validate.Read(&font, sizeof(font)) ||
+                (size_t) (validate.m_End - validate.m_Cursor) < (size_t) font.m_GlyphCount * sizeof(ImFontGlyph)) {
+                return false;
+            }
+
+            validate.m_Cursor += (size_t) font.m_GlyphCount * sizeof(ImFontGlyph);
+
+            // every font needs the config it was added with to finish its lookup tables
+            bool hasConfig = false;
+
+            for (const ImFontConfig &config: atlas->ConfigData) {
+                hasConfig |= config.DstFont == atlas->Fonts[(int) i] && !config.MergeMode;
+            }
+
+            if (!hasConfig) {
+                return false;
+            }
+        }
+
+        size_t pixelCount = (size_t) header.m_TexWidth * header.m_TexHeight;
+
+        if ((size_t) (validate.m_End - validate.m_Cursor) != pixelCount) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < header.m_FontCount; i++) {
+            ImFont *dst = atlas->Fonts[(int) i];
+            ImGui_FontCache_Font font{};
+            reader.Read(&font, sizeof(font));
+
+            dst->ClearOutputData();
+            dst->FontSize = font.m_FontSize;
+            dst->Ascent = font.m_Ascent;
+            dst->Descent = font.m_Descent;
+            dst->MetricsTotalSurface = font.m_MetricsTotalSurface;
+            dst->ContainerAtlas = atlas;
+
+            dst->Glyphs.resize((int) font.m_GlyphCount);
+            reader.Read(dst->Glyphs.Data, (size_t) font.m_GlyphCount * sizeof(ImFontGlyph));
+
+            // what ImFontAtlasBuildSetupFont would have done; BuildLookupTable reads the ellipsis of the config
+            // and picks the fallback and ellipsis glyphs again from the restored glyphs
+            dst->ConfigData = nullptr;
+            dst->ConfigDataCount = 0;
+
+            for (const ImFontConfig &config: atlas->ConfigData) {
+                if (config.DstFont != dst) {
+                    continue;
+                }
+
+                if (!config.MergeMode && !dst->ConfigData) {
+                    dst->ConfigData = &config;
+                }
+
+                dst->ConfigDataCount++;
+            }
+
+            dst->FallbackChar = (ImWchar) -1;
+            dst->EllipsisChar = dst->ConfigData->EllipsisChar;
+
+            dst->BuildLookupTable();
+        }
+
+        // the atlas owns its pixels and frees them with IM_FREE, so they are copied out of the mapping
+        atlas->ClearTexData();
+        atlas->TexPixelsAlpha8 = (unsigned char *) IM_ALLOC(pixelCount);
+        reader.Read(atlas->TexPixelsAlpha8, pixelCount);
+
+        atlas->TexWidth = header.m_TexWidth;
+        atlas->TexHeight = header.m_TexHeight;
+        atlas->TexUvScale = header.m_TexUvScale;
+        atlas->TexUvWhitePixel = header.m_TexUvWhitePixel;
+        atlas->TexPixelsUseColors = header.m_TexPixelsUseColors != 0;
+        memcpy(atlas->TexUvLines, uvLines, sizeof(uvLines));
+        atlas->TexReady = true;
+
+        return true;
+    }
+
+    bool ImGui_FontCache_Save(ImFontAtlas *atlas, const char *path) {
+        if (!path || !atlas->IsBuilt() || !atlas->TexPixelsAlpha8) {
+            return false;
+        }
+
+        ImGui_FontCache_Header header{};
+        memcpy(header.m_Magic, FONT_CACHE_MAGIC, sizeof(FONT_CACHE_MAGIC));
+        header.m_Version = FONT_CACHE_VERSION;
+        header.m_Key = ImGui_FontCache_ComputeKey(atlas);
+        header.m_GlyphSize = sizeof(ImFontGlyph);
+        header.m_FontCount = (uint32_t) atlas->Fonts.Size;
+        header.m_TexWidth = atlas->TexWidth;
+        header.m_TexHeight = atlas->TexHeight;
+        header.m_TexUvScale = atlas->TexUvScale;
+        header.m_TexUvWhitePixel = atlas->TexUvWhitePixel;
+        header.m_TexUvLineCount = IM_ARRAYSIZE(atlas->TexUvLines);
+        header.m_TexPixelsUseColors = atlas->TexPixelsUseColors ? 1 : 0;
+
+        // write to a temporary file first so a crash never leaves a truncated cache behind
+        char tmpPath[512];
+        snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+
+        FILE *f = fopen(tmpPath, "wb");
+
+        if (!f) {
+            return false;
+        }
+
+        bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+                  fwrite(atlas->TexUvLines, sizeof(atlas->TexUvLines), 1, f) == 1;
+
+        for (int i = 0; ok && i < atlas->Fonts.Size; i++) {
+            const ImFont *src = atlas->Fonts[i];
+
+            ImGui_FontCache_Font font{
+                    src->FontSize,
+                    src->Ascent,
+                    src->Descent,
+                    src->MetricsTotalSurface,
+                    (uint32_t) src->Glyphs.Size
+            };
+
+            ok = fwrite(&font, sizeof(font), 1, f) == 1 &&
+                 (src->Glyphs.Size == 0 ||
+                  fwrite(src->Glyphs.Data, sizeof(ImFontGlyph), src->Glyphs.Size, f) == (size_t) src->Glyphs.Size);
+        }
+
+        size_t pixelCount = (size_t) atlas->TexWidth * atlas->TexHeight;
+        ok = ok && fwrite(atlas->TexPixelsAlpha8, 1, pixelCount, f) == pixelCount;
+        ok = fclose(f) == 0 && ok;
+
+        if (!ok) {
+            remove(tmpPath);
+            return false;
+        }
+
+        remove(path);
+        return rename(tmpPath, path) == 0;
+    }
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <Engine/UI/ImGui.hpp>
+
+namespace engine::ui {
+    // restores a previously saved atlas (pixels, glyph tables and metrics) into fonts that were added but not built.
+    // fails when the cache is missing, unreadable or was built from different font data or configuration
+    extern bool ImGui_FontCache_Load(ImFontAtlas *atlas, const char *path);
+
+    // writes the current state of a built atlas; must run before the atlas pixels are cleared
+    extern bool ImGui_FontCache_Save(ImFontAtlas *atlas, const char *path);
+}
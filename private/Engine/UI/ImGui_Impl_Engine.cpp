@@ -1,8 +1,23 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <Engine/UI/ImGui_Engine_Mappings.hpp>
 #include <Engine/UI/ImGui_Impl_Engine.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Arena.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Capture.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_InputQueue.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Textures.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Touch.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_VertexConvert.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_WorkerPool.hpp>
 
 #include <Engine/Core/Runtime/Graphics/ITexture.hpp>
 #include <Engine/Core/Runtime/Graphics/Vertex.hpp>
@@ -16,30 +31,183 @@
 #include <imgui_internal.h>
 
 namespace engine::ui {
-    struct ImGui_ImplEngine_Data {
+    // a run of draw commands submitted as one UIRenderItem, or a user callback to invoke in its place
+    struct ImGui_ImplEngine_DrawBatch {
+        core::runtime::graphics::ITexture *m_Texture;
+        ImVec2 m_ClipMin;
+        ImVec2 m_ClipMax;
+        uint32_t m_IdxOffset;
+        uint32_t m_IdxCount;
+        const ImDrawList *m_CallbackList;
+        const ImDrawCmd *m_CallbackCmd;
+        // position of the owning draw list in ImDrawData::CmdLists
+        uint32_t m_ListIdx;
+    };
+
+    struct ImGui_ImplEngine_RetainedList;
+
+    // conversion of one draw list. its arena ranges are assigned up front, so lists can be converted in any order
+    // and on any thread while the frame still comes out exactly as if they were converted one after another
+    struct ImGui_ImplEngine_ListWork {
+        const ImDrawList *m_CmdList;
+        core::runtime::graphics::Vertex *m_VtxDst;
+        uint32_t m_VtxBase;
+        uint32_t *m_IdxDst;
+        uint32_t m_IdxBase;
+
+        std::vector<ImGui_ImplEngine_DrawBatch> m_Batches;
+        uint32_t m_CommandCount;
+        uint32_t m_MergedCommandCount;
+
+        // retained submission only: the cached list, and whether it had to be converted again
+        ImGui_ImplEngine_RetainedList *m_Retained;
+        bool m_Rebuilt;
+    };
+
+    // what an ImGui viewport is shown in. the main viewport is the backend's own window, which it does not own
+    struct ImGui_ImplEngine_ViewportData {
+        core::runtime::graphics::IGraphicsContext *m_GfxContext = nullptr;
+        core::runtime::graphics::IRenderer *m_Renderer = nullptr;
+        bool m_WindowOwned = false;
+    };
+
+    // draw list content kept from a previous frame for ImGui_RiftFlags_RetainedSubmission
+    struct ImGui_ImplEngine_RetainedItem {
+        core::runtime::graphics::ITexture *m_Texture;
+        ImVec2 m_ClipMin;
+        ImVec2 m_ClipMax;
+        // index of the user callback command in the draw list, or -1 for regular geometry
+        int m_CallbackCmdIdx;
+        std::vector<core::runtime::graphics::Vertex> m_Vertices;
+    };
+
+    struct ImGui_ImplEngine_RetainedList {
+        // m_Items hold the vertices of m_Hash and are kept for the next frame. a list changing frame after frame
+        // is not worth the copy: its items are only valid for the frame they were built in and handed over whole
+        bool m_Valid = false;
+        bool m_HasHash = false;
+        // frames in a row the content changed in
+        uint32_t m_ChangedFrames = 0;
+        uint64_t m_Hash = 0;
+        ImGui_RiftFlags m_Flags = 0;
+        uint32_t m_LastFrame = 0;
+        uint32_t m_CommandCount = 0;
+        uint32_t m_MergedCommandCount = 0;
+        std::vector<ImGui_ImplEngine_RetainedItem> m_Items;
+    };
+
+    // font state of one ImFontAtlas (hung off ImFontAtlas::UserData), shared by every backend drawing with it
+    struct ImGui_ImplEngine_FontData {
+        int m_RefCount = 0;
         std::unique_ptr<core::runtime::graphics::ITexture> m_FontTexture;
+
+        // glyphs the atlas is built with: the default ranges plus everything requested at runtime
+        std::mutex m_GlyphLock;
+        ImFontGlyphRangesBuilder m_GlyphBuilder;
+        ImVector<ImWchar> m_GlyphRanges;
+        // set when the atlas has to be rebuilt before the next frame: new glyphs or new fonts. ImGui's atlas cannot
+        // be packed incrementally, so every rebuild re-rasterizes all fonts and uploads the whole texture again
+        std::atomic<bool> m_GlyphsDirty = false;
+
+        // held shared by every frame building widgets with the atlas; rebuilding it takes it exclusively
+        std::shared_mutex m_AtlasLock;
+    };
+
+    struct ImGui_ImplEngine_Data {
+        ImGui_ImplEngine_FontData *m_FontData = nullptr;
+        bool m_HoldsAtlasLock = false;
         core::runtime::graphics::IGraphicsContext *m_GfxContext;
         core::runtime::graphics::IRenderer *m_Renderer;
         std::unique_ptr<input::ImGuiInputTarget> m_UIInputTarget;
+        // images for ImGui::Image; the font atlas texture is managed separately
+        ImGui_ImplEngine_TextureRegistry m_Textures;
+
+        // secondary viewports, see ImGui_EnableViewports
+        ImGui_ViewportWindowHooks m_ViewportHooks;
+        bool m_ViewportsEnabled = false;
+        // screen position of the window engine input is relative to, while viewports are enabled
+        ImVec2 m_MouseOrigin = {0.f, 0.f};
+
+        // renderer of the viewport being submitted, and where its draw lists start in m_ListStats
+        core::runtime::graphics::IRenderer *m_TargetRenderer = nullptr;
+        uint32_t m_ListStatsBase = 0;
+
+        // converted vertices and rebased indices of the frame being submitted
+        ImGui_ImplEngine_FrameArena m_FrameArena;
+        ImGui_ImplEngine_ConvertVerticesFn m_ConvertVertices;
+        // one entry per draw list of the frame; kept between frames so the batch vectors keep their capacity
+        std::vector<ImGui_ImplEngine_ListWork> m_ListWork;
+        // batches being merged into the next UIRenderItem
+        std::vector<const ImGui_ImplEngine_DrawBatch *> m_MergeRun;
+        std::vector<ImGui_ImplEngine_ListStats> m_ListStats;
+        std::unordered_map<const ImDrawList *, ImGui_ImplEngine_RetainedList> m_RetainedLists;
+
+        ImGui_RiftFlags m_Flags = ImGui_RiftFlags_None;
+        uint32_t m_FrameIndex = 0;
+        uint32_t m_CommandCount = 0;
+        uint32_t m_SubmittedCommandCount = 0;
+        uint32_t m_SubmittedVertexCount = 0;
+        uint32_t m_SubmitAllocationCount = 0;
+        size_t m_SubmitAllocatedBytes = 0;
+        uint32_t m_MergedCommandCount = 0;
+        uint32_t m_RetainedListCount = 0;
+        uint32_t m_RebuiltListCount = 0;
+        uint32_t m_ConversionThreadCount = 0;
+
+        // below this many vertices a frame is not worth spreading over threads
+        uint32_t m_ParallelThreshold = 20000;
+
+        // input may arrive on any thread; it is queued and only applied to ImGui in NewFrame
+        ImGui_ImplEngine_InputQueue m_InputQueue;
+        std::atomic<bool> m_HasActivity = true;
+        // io.WantCaptureMouse / WantCaptureKeyboard of the last frame, for input listeners off the UI thread
+        std::atomic<bool> m_WantCapture = false;
+        std::atomic<uint32_t> m_DroppedInputEventCount = 0;
+        uint32_t m_InputEventCount = 0;
+        uint32_t m_CoalescedInputEventCount = 0;
+        // first half of a UTF-16 surrogate pair typed, waiting for the second one
+        ImWchar16 m_HighSurrogate = 0;
+        ImGui_ImplEngine_TouchState m_Touch;
+
+        // draw data and input streamed to disk, see ImGui_StartCapture
+        ImGui_ImplEngine_CaptureWriter m_Capture;
+
+        ImGui_FrameClockFn m_FrameClock = nullptr;
+        double m_Time = 0.0;
+
+        // replaces IRenderer::SubmitUI when set; also what headless backends (no renderer) submit to
+        ImGui_ImplEngine_SubmitHook m_SubmitHook = nullptr;
+        void *m_SubmitHookUserData = nullptr;
+        // display size used when running without a graphics context
+        ImVec2 m_HeadlessDisplaySize = {1280.f, 720.f};
     };
 
     static ImGui_ImplEngine_Data *ImGui_ImplEngine_GetBackendData() {
         return ImGui::GetCurrentContext() ? (ImGui_ImplEngine_Data *) ImGui::GetIO().BackendRendererUserData : nullptr;
     }
 
+    // what input listeners push into; they may run on another thread and must not touch the ImGui context
+    static std::atomic<ImGui_ImplEngine_Data *> g_InputBackendData = nullptr;
+    // every live backend in the order they were initialized; input focus falls back to the first one
+    static std::vector<ImGui_ImplEngine_Data *> g_Backends;
+    // guards g_Backends, the worker pool and the creation / release of shared font data
+    static std::mutex g_BackendLock;
+    // listeners between picking up g_InputBackendData and being done with it; a backend is only freed once no
+    // listener can still be holding it
+    static std::atomic<int> g_InputListenersInFlight = 0;
+    // shared by every backend, started the first time a frame is converted in parallel
+    static ImGui_ImplEngine_WorkerPool *g_WorkerPool = nullptr;
+
     void ImGui_ImplEngine_OnKeyStateChanged(input::InputKeyHandle key, bool state) {
-        auto x = ImGui_ImplEngine_MapKey(key);
+        // one lookup serves both keyboard keys and mouse buttons
+        auto mapping = ImGui_ImplEngine_LookupKey(key);
 
-        if (x != ImGuiKey_None) {
-            ImGui::GetIO().AddKeyEvent(x, state);
+        if (mapping.m_Key != ImGuiKey_None) {
+            ImGui::GetIO().AddKeyEvent(mapping.m_Key, state);
         }
-    }
 
-    void ImGui_ImplEngine_OnMouseStateChanged(input::InputKeyHandle key, bool state) {
-        auto x = ImGui_ImplEngine_MapInputDeviceButton(key);
-
-        if (x != ImGuiMouseButton_COUNT) {
-            ImGui::GetIO().AddMouseButtonEvent(x, state);
+        if (mapping.m_MouseButton != ImGuiMouseButton_COUNT) {
+            ImGui::GetIO().AddMouseButtonEvent(mapping.m_MouseButton, state);
         }
     }
 
@@ -50,65 +218,168 @@ namespace engine::ui {
         io.AddMousePosEvent(position.x, position.y);
     }
 
-    void ImGui_ImplEngine_OnTouchMove(int fingerId, core::math::Vector2 position) {
-        ImGuiIO &io = ImGui::GetIO();
-
-        // make sure we're tracking only the first finger
-        if (fingerId == 0) {
-            io.AddMouseSourceEvent(ImGuiMouseSource_TouchScreen);
-            io.AddMousePosEvent(position.x, position.y);
+    // caller holds m_GlyphLock. codepoints past IM_UNICODE_CODEPOINT_MAX (no IMGUI_USE_WCHAR32) cannot be drawn
+    static void ImGui_ImplEngine_RequestGlyph(ImGui_ImplEngine_FontData *fd, unsigned int codepoint) {
+        if (codepoint == 0 || codepoint > IM_UNICODE_CODEPOINT_MAX || fd->m_GlyphBuilder.GetBit(codepoint)) {
+            return;
         }
+
+        // every codepoint triggers at most one rebuild of the whole atlas, even if none of the fonts can provide it
+        fd->m_GlyphBuilder.AddChar((ImWchar) codepoint);
+        fd->m_GlyphsDirty = true;
     }
 
-    void ImGui_ImplEngine_OnTouchDown(int fingerId, core::math::Vector2 position) {
-        ImGui_ImplEngine_OnTouchMove(fingerId, position);
+    void ImGui_ImplEngine_RequestGlyphs(ImFontAtlas *atlas, const char *text) {
+        auto fd = (ImGui_ImplEngine_FontData *) atlas->UserData;
 
-        // make sure we're tracking only the first finger
-        if (fingerId == 0) {
-            ImGui::GetIO().AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+        if (!fd) {
+            return;
         }
-    }
 
-    void ImGui_ImplEngine_OnTouchUp(int fingerId, core::math::Vector2 position) {
-        ImGui_ImplEngine_OnTouchMove(fingerId, position);
+        const char *textEnd = text + strlen(text);
+        std::lock_guard lock(fd->m_GlyphLock);
 
-        // make sure we're tracking only the first finger
-        if (fingerId == 0) {
-            ImGui::GetIO().AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+        while (text < textEnd) {
+            unsigned int codepoint;
+            text += ImTextCharFromUtf8(&codepoint, text, textEnd);
+            ImGui_ImplEngine_RequestGlyph(fd, codepoint);
         }
     }
 
-    bool ImGui_ImplEngine_OnInputEvent(const input::InputEvent &event) {
+    void ImGui_ImplEngine_InvalidateFontAtlas() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_FontData->m_GlyphsDirty = true;
+    }
+
+    void ImGui_ImplEngine_SetInputFocus() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        g_InputBackendData.store(bd, std::memory_order_release);
+    }
+
+    static void ImGui_ImplEngine_ProcessInputEvent(ImGui_ImplEngine_Data *bd, const input::InputEvent &event) {
         ImGuiIO &io = ImGui::GetIO();
+        ImVec2 position = {event.Position.x + bd->m_MouseOrigin.x, event.Position.y + bd->m_MouseOrigin.y};
 
         switch (event.Type) {
-            case input::INPUT_EVENT_TYPE_INPUT_CHAR:
+            case input::INPUT_EVENT_TYPE_INPUT_CHAR: {
                 io.AddInputCharacterUTF16(event.UInputChar);
+
+                // characters arrive as UTF-16 units; a pair only names a glyph once both halves are in
+                unsigned int codepoint = event.UInputChar;
+
+                if (codepoint >= 0xD800 && codepoint < 0xDC00) {
+                    bd->m_HighSurrogate = (ImWchar16) codepoint;
+                    break;
+                }
+
+                if (codepoint >= 0xDC00 && codepoint < 0xE000) {
+                    if (!bd->m_HighSurrogate) {
+                        break;
+                    }
+
+                    codepoint = 0x10000 + ((bd->m_HighSurrogate - 0xD800u) << 10) + (codepoint - 0xDC00);
+                }
+
+                bd->m_HighSurrogate = 0;
+
+                std::lock_guard lock(bd->m_FontData->m_GlyphLock);
+                ImGui_ImplEngine_RequestGlyph(bd->m_FontData, codepoint);
                 break;
+            }
             case input::INPUT_EVENT_TYPE_KEY_STATE_CHANGE:
                 ImGui_ImplEngine_OnKeyStateChanged(event.Key, event.KeyState);
-                ImGui_ImplEngine_OnMouseStateChanged(event.Key, event.KeyState);
                 break;
             case input::INPUT_EVENT_TYPE_MOUSE_POSITION:
-                ImGui_ImplEngine_OnMousePosition(event.Position);
+                ImGui_ImplEngine_OnMousePosition({position.x, position.y});
                 break;
             case input::INPUT_EVENT_TYPE_TOUCH_MOVE:
-                ImGui_ImplEngine_OnTouchMove(event.TouchFinger, event.Position);
+                bd->m_Touch.OnTouchMove(io, event.TouchFinger, position);
                 break;
             case input::INPUT_EVENT_TYPE_TOUCH_DOWN:
-                ImGui_ImplEngine_OnTouchDown(event.TouchFinger, event.Position);
+                bd->m_Touch.OnTouchDown(io, event.TouchFinger, position);
                 break;
             case input::INPUT_EVENT_TYPE_TOUCH_UP:
-                ImGui_ImplEngine_OnTouchUp(event.TouchFinger, event.Position);
+                bd->m_Touch.OnTouchUp(io, event.TouchFinger, position);
                 break;
             case input::INPUT_EVENT_TYPE_TOUCH_HOVER:
-                ImGui_ImplEngine_OnTouchMove(0, event.Position);
+                bd->m_Touch.OnHover(io, position);
                 break;
             default:
                 break;
         }
+    }
+
+    // mouse events leave TouchFinger unset, it only tells touch sources apart
+    static bool ImGui_ImplEngine_IsSameMoveSource(const input::InputEvent &a, const input::InputEvent &b) {
+        return a.Type == b.Type && (a.Type == input::INPUT_EVENT_TYPE_MOUSE_POSITION || a.TouchFinger == b.TouchFinger);
+    }
+
+    static bool ImGui_ImplEngine_IsMoveEvent(const input::InputEvent &event) {
+        return event.Type == input::INPUT_EVENT_TYPE_MOUSE_POSITION ||
+               event.Type == input::INPUT_EVENT_TYPE_TOUCH_MOVE ||
+               event.Type == input::INPUT_EVENT_TYPE_TOUCH_HOVER;
+    }
+
+    // applies everything queued since the last frame, in order. of a run of moves from the same source only the
+    // last position is kept; ImGui would otherwise queue and trickle every one of them
+    static void ImGui_ImplEngine_DrainInputQueue(ImGui_ImplEngine_Data *bd) {
+        input::InputEvent event;
+        input::InputEvent pendingMove;
+        bool hasPendingMove = false;
+
+        bd->m_InputEventCount = 0;
+        bd->m_CoalescedInputEventCount = 0;
+
+        while (bd->m_InputQueue.Pop(event)) {
+            bd->m_InputEventCount++;
+
+            if (hasPendingMove) {
+                if (ImGui_ImplEngine_IsMoveEvent(event) && ImGui_ImplEngine_IsSameMoveSource(event, pendingMove)) {
+                    pendingMove = event;
+                    bd->m_CoalescedInputEventCount++;
+                    continue;
+                }
+
+                ImGui_ImplEngine_ProcessInputEvent(bd, pendingMove);
+                hasPendingMove = false;
+            }
+
+            if (ImGui_ImplEngine_IsMoveEvent(event)) {
+                pendingMove = event;
+                hasPendingMove = true;
+            } else {
+                ImGui_ImplEngine_ProcessInputEvent(bd, event);
+            }
+        }
+
+        if (hasPendingMove) {
+            ImGui_ImplEngine_ProcessInputEvent(bd, pendingMove);
+        }
+    }
+
+    bool ImGui_ImplEngine_OnInputEvent(const input::InputEvent &event) {
+        // counted before the load, so a Shutdown that swapped focus away either sees this listener or is not seen
+        g_InputListenersInFlight.fetch_add(1);
+        auto bd = g_InputBackendData.load();
+        bool wantCapture = false;
+
+        if (bd) {
+            bd->m_Capture.WriteInputEvent(event);
+
+            if (!bd->m_InputQueue.Push(event)) {
+                bd->m_DroppedInputEventCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            bd->m_HasActivity.store(true, std::memory_order_release);
+            wantCapture = bd->m_WantCapture.load(std::memory_order_relaxed);
+        }
 
-        return io.WantCaptureMouse || io.WantCaptureKeyboard;
+        g_InputListenersInFlight.fetch_sub(1, std::memory_order_release);
+        return wantCapture;
     }
 
     bool ImGui_ImplEngine_Init(core::runtime::graphics::IGraphicsContext *gContext,
@@ -151,21 +422,41 @@ namespace engine::ui {
         ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
         bd->m_GfxContext = gContext;
         bd->m_Renderer = renderer;
+        bd->m_ConvertVertices = ImGui_ImplEngine_GetVertexConverter();
+        bd->m_Textures.SetGraphicsBackend(gContext ? gContext->GetBackend() : nullptr);
+
+        std::lock_guard lock(g_BackendLock);
+
+        // the first backend on an atlas sets up the font state every later one shares
+        if (!io.Fonts->UserData) {
+            auto fd = IM_NEW(ImGui_ImplEngine_FontData)();
+            fd->m_GlyphBuilder.AddRanges(io.Fonts->GetGlyphRangesDefault());
+            io.Fonts->UserData = fd;
+        }
+
+        bd->m_FontData = (ImGui_ImplEngine_FontData *) io.Fonts->UserData;
+        bd->m_FontData->m_RefCount++;
+
+        // input goes to the first backend until another one asks for it
+        ImGui_ImplEngine_Data *noFocus = nullptr;
+        g_InputBackendData.compare_exchange_strong(noFocus, bd, std::memory_order_acq_rel);
+
+        g_Backends.push_back(bd);
 
-        input::InputManager::Instance()->AddInputListener(ImGui_ImplEngine_OnInputEvent, true);
+        if (g_Backends.size() == 1) {
+            input::InputManager::Instance()->AddInputListener(ImGui_ImplEngine_OnInputEvent, true);
+        }
 
         return true;
     }
 
-    void ImGui_ImplEngine_DestroyFontsTexture() {
-        ImGuiIO &io = ImGui::GetIO();
-        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
-
-        if (bd->m_FontTexture) {
-            bd->m_FontTexture->Destroy();
-            io.Fonts->SetTexID(nullptr);
-            bd->m_FontTexture = nullptr;
+    static void ImGui_ImplEngine_DestroyFontsTexture(ImFontAtlas *atlas, ImGui_ImplEngine_FontData *fd) {
+        if (fd->m_FontTexture) {
+            fd->m_FontTexture->Destroy();
+            fd->m_FontTexture = nullptr;
         }
+
+        atlas->SetTexID(nullptr);
     }
 
     void ImGui_ImplEngine_Shutdown() {
@@ -173,15 +464,51 @@ namespace engine::ui {
         IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
         ImGuiIO &io = ImGui::GetIO();
 
-        auto inputManager = input::InputManager::Instance();
-        inputManager->RemoveInputListener(ImGui_ImplEngine_OnInputEvent);
+        if (bd->m_HoldsAtlasLock) {
+            bd->m_FontData->m_AtlasLock.unlock_shared();
+        }
+
+        bd->m_Capture.Stop();
+
+        // closes the windows of the secondary viewports and frees the data of every viewport
+        if (bd->m_ViewportsEnabled) {
+            ImGui::DestroyPlatformWindows();
+            io.BackendFlags &= ~(ImGuiBackendFlags_PlatformHasViewports | ImGuiBackendFlags_RendererHasViewports);
+        }
+
+        {
+            std::lock_guard lock(g_BackendLock);
+
+            g_Backends.erase(std::find(g_Backends.begin(), g_Backends.end(), bd));
+
+            // a focused backend hands input to the oldest one still alive, usually the default context's
+            ImGui_ImplEngine_Data *focus = bd;
+            g_InputBackendData.compare_exchange_strong(focus, g_Backends.empty() ? nullptr : g_Backends.front());
 
-        ImGui_ImplEngine_DestroyFontsTexture();
+            if (g_Backends.empty()) {
+                input::InputManager::Instance()->RemoveInputListener(ImGui_ImplEngine_OnInputEvent);
+
+                IM_DELETE(g_WorkerPool);
+                g_WorkerPool = nullptr;
+            }
+
+            if (--bd->m_FontData->m_RefCount == 0) {
+                ImGui_ImplEngine_DestroyFontsTexture(io.Fonts, bd->m_FontData);
+                IM_DELETE(bd->m_FontData);
+                io.Fonts->UserData = nullptr;
+            }
+        }
 
         io.BackendRendererName = nullptr;
         io.BackendRendererUserData = nullptr;
         io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
 
+        // no listener picks bd up anymore, wait for the ones that did before focus moved on. listeners only push
+        // into a queue, this is short
+        while (g_InputListenersInFlight.load() != 0) {
+            std::this_thread::yield();
+        }
+
         IM_DELETE(bd);
     }
 
@@ -191,108 +518,1064 @@ namespace engine::ui {
 
         ImGuiIO &io = ImGui::GetIO();
 
-        // create font atlas texture from ImGUI
-        core::runtime::graphics::Color *pixels;
+        // ImGui rasterizes the atlas as alpha only; asking for RGBA32 makes it keep a second, 4x larger copy.
+        // fetch the alpha and expand it straight into the texture descriptor instead
+        unsigned char *alphaPixels;
         int width, height;
 
-        io.Fonts->GetTexDataAsRGBA32(reinterpret_cast<unsigned char **>(&pixels), &width, &height);
+        io.Fonts->GetTexDataAsAlpha8(&alphaPixels, &width, &height);
 
-        // create font texture and upload it to GPU
-        bd->m_FontTexture = bd->m_GfxContext->GetBackend()->CreateTexture();
-        IM_ASSERT(bd->m_FontTexture != nullptr && "Failed to create font atlas texture!");
-        bd->m_FontTexture->Create({
-                                          {
-                                                  pixels,
-                                                  pixels + width * height
-                                          },
+        // headless backends still rasterize the atlas but have nothing to upload to; any non-null id will do
+        if (!bd->m_GfxContext) {
+            io.Fonts->SetTexID((ImTextureID) io.Fonts);
+            return;
+        }
+
+        std::vector<core::runtime::graphics::Color> pixels;
+
+        if (io.Fonts->TexPixelsUseColors) {
+            // colored glyphs (e.g. emoji fonts) only exist in the RGBA32 version of the atlas
+            core::runtime::graphics::Color *rgbaPixels;
+            io.Fonts->GetTexDataAsRGBA32(reinterpret_cast<unsigned char **>(&rgbaPixels), &width, &height);
+            pixels.assign(rgbaPixels, rgbaPixels + width * height);
+        } else {
+            pixels.resize((size_t) width * height);
+
+            for (size_t i = 0; i < pixels.size(); i++) {
+                pixels[i] = {255, 255, 255, alphaPixels[i]};
+            }
+        }
+
+        ImGui_ImplEngine_OrientTexturePixels(pixels, width, height);
+
+        // create font texture and upload it to GPU; an existing one is refilled in place so the id stays valid
+        auto &fontTexture = bd->m_FontData->m_FontTexture;
+
+        if (!fontTexture) {
+            fontTexture = bd->m_GfxContext->GetBackend()->CreateTexture();
+            IM_ASSERT(fontTexture != nullptr && "Failed to create font atlas texture!");
+        } else {
+            fontTexture->Destroy();
+        }
+
+        fontTexture->Create({
+                                          std::move(pixels),
                                           {
                                                   (float) width,
                                                   (float) height
                                           }
                                   });
 
-        io.Fonts->SetTexID((ImTextureID) bd->m_FontTexture.get());
+        io.Fonts->SetTexID((ImTextureID) fontTexture.get());
+
+        // glyph tables stay, only the CPU copy of the pixels goes; the atlas is rebuilt if it is ever needed again
+        if (!(bd->m_Flags & ImGui_RiftFlags_KeepFontAtlasPixels)) {
+            io.Fonts->ClearTexData();
+        }
+    }
+
+    static double ImGui_ImplEngine_GetTime(ImGui_ImplEngine_Data *bd) {
+        if (bd->m_FrameClock) {
+            return bd->m_FrameClock();
+        }
+
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
     }
 
+    // a full rebuild: re-rasterizes every font of the atlas with all glyphs requested so far and uploads the whole
+    // font texture again. caller holds the atlas lock exclusively
+    static void ImGui_ImplEngine_RebuildAtlas(ImGui_ImplEngine_FontData *fd) {
+        ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+        const ImWchar *previousRanges = fd->m_GlyphRanges.Data;
+
+        {
+            std::lock_guard lock(fd->m_GlyphLock);
+            fd->m_GlyphRanges.clear();
+            fd->m_GlyphBuilder.BuildRanges(&fd->m_GlyphRanges);
+            fd->m_GlyphsDirty = false;
+        }
+
+        // fonts with explicit ranges (icon fonts, merged symbol sets) are left alone
+        for (auto &config: atlas->ConfigData) {
+            if (!config.GlyphRanges || config.GlyphRanges == atlas->GetGlyphRangesDefault() ||
+                config.GlyphRanges == previousRanges) {
+                config.GlyphRanges = fd->m_GlyphRanges.Data;
+            }
+        }
+
+        atlas->ClearTexData();
+
+        if (atlas->TexID) {
+            ImGui_ImplEngine_CreateFontsTexture();
+        }
+    }
+
+    static ImVec2 ImGui_ImplEngine_GetDisplaySize(ImGui_ImplEngine_Data *bd) {
+        if (!bd->m_GfxContext) {
+            return bd->m_HeadlessDisplaySize;
+        }
+
+        auto winSize = bd->m_GfxContext->GetOwnerWindow()->GetSize();
+        return {winSize.x, winSize.y};
+    }
+
+    static void ImGui_ImplEngine_UpdateMonitors(ImGui_ImplEngine_Data *bd);
+    static void ImGui_ImplEngine_UpdateMouseOrigin(ImGui_ImplEngine_Data *bd);
+
     void ImGui_ImplEngine_NewFrame() {
         ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
         IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
 
         ImGuiIO &io = ImGui::GetIO();
 
-        io.DeltaTime = (float) 1.f / 60.f;
-        auto winSize = bd->m_GfxContext->GetOwnerWindow()->GetSize();
-        io.DisplaySize = {winSize.x, winSize.y};
+        // ImGui requires a strictly positive delta; the very first frame has nothing to measure against
+        double currentTime = ImGui_ImplEngine_GetTime(bd);
+        float deltaTime = bd->m_Time > 0.0 ? (float) (currentTime - bd->m_Time) : 1.f / 60.f;
+        io.DeltaTime = deltaTime > 0.f ? deltaTime : 1e-6f;
+        bd->m_Time = currentTime;
 
-        if (!bd->m_FontTexture) {
-            ImGui_ImplEngine_CreateFontsTexture();
+        io.DisplaySize = ImGui_ImplEngine_GetDisplaySize(bd);
+
+        if (bd->m_ViewportsEnabled) {
+            ImGui_ImplEngine_UpdateMonitors(bd);
+            ImGui_ImplEngine_UpdateMouseOrigin(bd);
+        }
+
+        // typed characters may request glyphs, so this has to happen before the atlas is checked
+        ImGui_ImplEngine_DrainInputQueue(bd);
+
+        if (bd->m_UIInputTarget) {
+            bd->m_UIInputTarget->ApplyEdits();
+        }
+
+        bd->m_Touch.Update(io, io.DeltaTime);
+        bd->m_Textures.BeginFrame();
+
+        // the atlas can only be rebuilt here, ImGui locks it between NewFrame and Render. other contexts sharing it
+        // may be building widgets right now; if so the rebuild waits for a later frame instead of blocking this one
+        auto fd = bd->m_FontData;
+
+        if ((fd->m_GlyphsDirty || !io.Fonts->TexID) && fd->m_AtlasLock.try_lock()) {
+            if (fd->m_GlyphsDirty) {
+                ImGui_ImplEngine_RebuildAtlas(fd);
+            }
+
+            if (!io.Fonts->TexID) {
+                ImGui_ImplEngine_CreateFontsTexture();
+            }
+
+            fd->m_AtlasLock.unlock();
         }
+
+        // released in RenderDrawData, once ImGui::Render is done with the atlas
+        fd->m_AtlasLock.lock_shared();
+        bd->m_HoldsAtlasLock = true;
     }
 
-    void ImGui_ImplEngine_RenderDrawData(ImDrawData *drawData) {
-        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
-        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+    // cheap 64-bit content hash, consumed a word at a time; only used to detect changes between frames
+    static uint64_t ImGui_ImplEngine_HashBytes(const void *data, size_t size, uint64_t seed) {
+        constexpr uint64_t k = 0x9E3779B97F4A7C15ull;
+
+        auto bytes = (const uint8_t *) data;
+        uint64_t h = seed ^ (size * k);
+
+        for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+            uint64_t w;
+            memcpy(&w, bytes, sizeof(w));
+            h = (h ^ w) * k;
+            h ^= h >> 32;
+        }
+
+        if (size > 0) {
+            uint64_t w = 0;
+            memcpy(&w, bytes, size);
+            h = (h ^ w) * k;
+            h ^= h >> 32;
+        }
+
+        return h;
+    }
+
+    uint64_t ImGui_ImplEngine_HashDrawList(const ImDrawList *cmdList, ImVec2 clip_off, ImVec2 clip_scale) {
+        float projection[4] = {clip_off.x, clip_off.y, clip_scale.x, clip_scale.y};
+        uint64_t h = ImGui_ImplEngine_HashBytes(projection, sizeof(projection), 0);
+
+#ifdef RIFT_IMGUI_ENGINE_VERTEX_LAYOUT
+        // z and the normal are never written by ImGui; only what it writes is hashed, packed a batch at a time
+        constexpr int HASH_BATCH = 64;
+        uint32_t packed[HASH_BATCH * 5];
+
+        for (int start = 0; start < cmdList->VtxBuffer.Size; start += HASH_BATCH) {
+            int count = std::min(HASH_BATCH, cmdList->VtxBuffer.Size - start);
+            const ImDrawVert *vtx = cmdList->VtxBuffer.Data + start;
+
+            for (int i = 0; i < count; i++) {
+                memcpy(&packed[i * 5], &vtx[i].pos, sizeof(ImVec2));
+                memcpy(&packed[i * 5 + 2], &vtx[i].uv, sizeof(ImVec2));
+                packed[i * 5 + 4] = vtx[i].col;
+            }
+
+            h = ImGui_ImplEngine_HashBytes(packed, count * 5 * sizeof(uint32_t), h);
+        }
+#else
+        h = ImGui_ImplEngine_HashBytes(cmdList->VtxBuffer.Data, cmdList->VtxBuffer.Size * sizeof(ImDrawVert), h);
+#endif
+        h = ImGui_ImplEngine_HashBytes(cmdList->IdxBuffer.Data, cmdList->IdxBuffer.Size * sizeof(ImDrawIdx), h);
+
+        // commands are hashed field by field, their padding is not guaranteed to be initialized
+        for (const auto &cmd: cmdList->CmdBuffer) {
+            h = ImGui_ImplEngine_HashBytes(&cmd.ClipRect, sizeof(cmd.ClipRect), h);
+
+            ImTextureID texId = cmd.GetTexID();
+            h = ImGui_ImplEngine_HashBytes(&texId, sizeof(texId), h);
+
+            unsigned int ranges[3] = {cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount};
+            h = ImGui_ImplEngine_HashBytes(ranges, sizeof(ranges), h);
+
+            const void *callback[2] = {(const void *) cmd.UserCallback, cmd.UserCallbackData};
+            h = ImGui_ImplEngine_HashBytes(callback, sizeof(callback), h);
+        }
+
+        return h;
+    }
+
+    static bool ImGui_ImplEngine_CanMerge(core::runtime::graphics::ITexture *texture, ImVec2 clipMin, ImVec2 clipMax,
+                                          core::runtime::graphics::ITexture *otherTexture, ImVec2 otherClipMin,
+                                          ImVec2 otherClipMax) {
+        return texture == otherTexture &&
+               clipMin.x == otherClipMin.x && clipMin.y == otherClipMin.y &&
+               clipMax.x == otherClipMax.x && clipMax.y == otherClipMax.y;
+    }
+
+    // converts one draw list into its preassigned arena ranges and fills its batches; touches no shared state
+    static void ImGui_ImplEngine_BuildListBatches(ImGui_ImplEngine_Data *bd, ImGui_ImplEngine_ListWork &work,
+                                                  uint32_t listIdx, ImVec2 clip_off, ImVec2 clip_scale) {
+        bool mergeCommands = (bd->m_Flags & ImGui_RiftFlags_MergeCommands) != 0;
+        const ImDrawList *cmdList = work.m_CmdList;
+        auto &batches = work.m_Batches;
+
+        batches.clear();
+        work.m_CommandCount = 0;
+        work.m_MergedCommandCount = 0;
+
+        // convert the whole vertex buffer once per draw list; commands only index into it
+        bd->m_ConvertVertices(cmdList->VtxBuffer.Data, work.m_VtxDst, cmdList->VtxBuffer.Size);
+
+        // with viewports, ImGui draws in screen space; the renderer of each window expects its own space
+        if (clip_off.x != 0.f || clip_off.y != 0.f) {
+            ImGui_ImplEngine_TranslateVertices(work.m_VtxDst, cmdList->VtxBuffer.Size, {-clip_off.x, -clip_off.y});
+        }
+
+        uint32_t idxUsed = 0;
+
+        for (int cmdIdx = 0; cmdIdx < cmdList->CmdBuffer.Size; cmdIdx++) {
+            const ImDrawCmd *cmdPtr = &cmdList->CmdBuffer[cmdIdx];
+
+            if (cmdPtr->UserCallback) {
+                if (cmdPtr->UserCallback != ImDrawCallback_ResetRenderState) {
+                    batches.push_back({nullptr, {}, {}, 0, 0, cmdList, cmdPtr, listIdx});
+                }
+
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((cmdPtr->ClipRect.x - clip_off.x) * clip_scale.x,
+                            (cmdPtr->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((cmdPtr->ClipRect.z - clip_off.x) * clip_scale.x,
+                            (cmdPtr->ClipRect.w - clip_off.y) * clip_scale.y);
+
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y) { continue; }
+
+            // keep the list's indices rebased onto the arena; consecutive commands then occupy consecutive
+            // index ranges, which is what lets compatible commands be merged by just extending a batch
+            uint32_t idxOffset = work.m_IdxBase + idxUsed;
+            uint32_t *idxDst = work.m_IdxDst + idxUsed;
+            const ImDrawIdx *indexBuffer = cmdList->IdxBuffer.Data + cmdPtr->IdxOffset;
+            uint32_t idxBase = work.m_VtxBase + cmdPtr->VtxOffset;
+
+            for (unsigned int idxIdx = 0; idxIdx < cmdPtr->ElemCount; idxIdx++) {
+                idxDst[idxIdx] = idxBase + indexBuffer[idxIdx];
+            }
+
+            idxUsed += cmdPtr->ElemCount;
+
+            auto texture = (core::runtime::graphics::ITexture *) cmdPtr->GetTexID();
+            work.m_CommandCount++;
+
+            if (mergeCommands && !batches.empty()) {
+                auto &prev = batches.back();
+
+                if (!prev.m_CallbackCmd && prev.m_IdxOffset + prev.m_IdxCount == idxOffset &&
+                    ImGui_ImplEngine_CanMerge(prev.m_Texture, prev.m_ClipMin, prev.m_ClipMax,
+                                              texture, clip_min, clip_max)) {
+                    prev.m_IdxCount += cmdPtr->ElemCount;
+                    work.m_MergedCommandCount++;
+                    continue;
+                }
+            }
+
+            batches.push_back({texture, clip_min, clip_max, idxOffset, cmdPtr->ElemCount, nullptr, nullptr, listIdx});
+        }
+    }
+
+    // appends the converted vertices of a batch to a flat triangle list
+    static void ImGui_ImplEngine_GatherBatch(const ImGui_ImplEngine_FrameArena &arena,
+                                             const ImGui_ImplEngine_DrawBatch &batch,
+                                             std::vector<core::runtime::graphics::Vertex> &vertices) {
+        const core::runtime::graphics::Vertex *vertexBuffer = arena.GetVertices();
+        const uint32_t *batchIndices = arena.GetIndices() + batch.m_IdxOffset;
+
+        for (uint32_t idxIdx = 0; idxIdx < batch.m_IdxCount; idxIdx++) {
+            vertices.push_back(vertexBuffer[batchIndices[idxIdx]]);
+        }
+    }
+
+    static void ImGui_ImplEngine_SubmitVertices(ImGui_ImplEngine_Data *bd, uint32_t listIdx,
+                                                std::vector<core::runtime::graphics::Vertex> &&vertices,
+                                                core::runtime::graphics::ITexture *texture,
+                                                ImVec2 clipMin, ImVec2 clipMax) {
+        bd->m_SubmittedVertexCount += (uint32_t) vertices.size();
+
+        // UIRenderItem owns its vertices and IRenderer::SubmitUI never hands them back, so every item is a buffer of
+        // its own that cannot be pooled on this side
+        if (vertices.capacity() > 0) {
+            bd->m_SubmitAllocationCount++;
+            bd->m_SubmitAllocatedBytes += vertices.capacity() * sizeof(core::runtime::graphics::Vertex);
+        }
+
+        engine::core::runtime::graphics::UIRenderItem item{
+                engine::core::runtime::graphics::PrimitiveType::PRIMITIVE_TYPE_TRIANGLES,
+                std::move(vertices),
+                texture,
+                {clipMin.x, clipMin.y},
+                {clipMax.x - clipMin.x, clipMax.y - clipMin.y}
+        };
+
+        if (bd->m_SubmitHook) {
+            bd->m_SubmitHook(std::move(item), bd->m_SubmitHookUserData);
+        } else if (bd->m_TargetRenderer) {
+            bd->m_TargetRenderer->SubmitUI(std::move(item));
+        }
+        bd->m_SubmittedCommandCount++;
+        bd->m_ListStats[bd->m_ListStatsBase + listIdx].m_SubmitCount++;
+    }
+
+    // submits the batches of a run as a single item; the renderer takes ownership of a flat triangle list, so the
+    // already converted vertices are gathered by index into a vector sized exactly to the run
+    static void ImGui_ImplEngine_FlushRun(ImGui_ImplEngine_Data *bd) {
+        auto &run = bd->m_MergeRun;
+
+        if (run.empty()) {
+            return;
+        }
+
+        uint32_t vtxCount = 0;
+
+        for (auto batch: run) {
+            vtxCount += batch->m_IdxCount;
+        }
+
+        std::vector<core::runtime::graphics::Vertex> vtxCollection;
+        vtxCollection.reserve(vtxCount);
+
+        for (auto batch: run) {
+            ImGui_ImplEngine_GatherBatch(bd->m_FrameArena, *batch, vtxCollection);
+        }
+
+        // merges within a list already happened while converting it; these are the ones across list boundaries
+        bd->m_MergedCommandCount += (uint32_t) run.size() - 1;
+
+        ImGui_ImplEngine_SubmitVertices(bd, run[0]->m_ListIdx, std::move(vtxCollection), run[0]->m_Texture,
+                                        run[0]->m_ClipMin, run[0]->m_ClipMax);
+        run.clear();
+    }
+
+    static void ImGui_ImplEngine_SubmitImmediate(ImGui_ImplEngine_Data *bd) {
+        bool mergeCommands = (bd->m_Flags & ImGui_RiftFlags_MergeCommands) != 0;
+        auto &run = bd->m_MergeRun;
+
+        for (const auto &work: bd->m_ListWork) {
+            bd->m_CommandCount += work.m_CommandCount;
+            bd->m_MergedCommandCount += work.m_MergedCommandCount;
+
+            for (const auto &batch: work.m_Batches) {
+                if (batch.m_CallbackCmd) {
+                    ImGui_ImplEngine_FlushRun(bd);
+                    batch.m_CallbackCmd->UserCallback(batch.m_CallbackList, batch.m_CallbackCmd);
+                    continue;
+                }
+
+                if (!run.empty() &&
+                    !(mergeCommands && ImGui_ImplEngine_CanMerge(run.back()->m_Texture, run.back()->m_ClipMin,
+                                                                 run.back()->m_ClipMax, batch.m_Texture,
+                                                                 batch.m_ClipMin, batch.m_ClipMax))) {
+                    ImGui_ImplEngine_FlushRun(bd);
+                }
+
+                run.push_back(&batch);
+            }
+        }
+
+        ImGui_ImplEngine_FlushRun(bd);
+    }
+
+    // converts a draw list again only if its content changed since the last frame
+    static void ImGui_ImplEngine_ConvertRetained(ImGui_ImplEngine_Data *bd, ImGui_ImplEngine_ListWork &work,
+                                                 uint32_t listIdx, ImVec2 clip_off, ImVec2 clip_scale) {
+        const ImDrawList *cmdList = work.m_CmdList;
+        auto &entry = *work.m_Retained;
+        uint64_t hash = ImGui_ImplEngine_HashDrawList(cmdList, clip_off, clip_scale);
+        bool changed = !entry.m_HasHash || entry.m_Hash != hash || entry.m_Flags != bd->m_Flags;
+
+        entry.m_ChangedFrames = changed ? entry.m_ChangedFrames + 1 : 0;
+        work.m_Rebuilt = changed || !entry.m_Valid;
+
+        if (!work.m_Rebuilt) {
+            return;
+        }
+
+        ImGui_ImplEngine_BuildListBatches(bd, work, listIdx, clip_off, clip_scale);
+
+        // vectors of existing items are refilled in place so a changing list keeps its storage
+        entry.m_Items.resize(work.m_Batches.size());
+
+        for (size_t i = 0; i < work.m_Batches.size(); i++) {
+            auto &item = entry.m_Items[i];
+            const auto &batch = work.m_Batches[i];
+
+            item.m_Texture = batch.m_Texture;
+            item.m_ClipMin = batch.m_ClipMin;
+            item.m_ClipMax = batch.m_ClipMax;
+            item.m_CallbackCmdIdx = batch.m_CallbackCmd ? (int) (batch.m_CallbackCmd - cmdList->CmdBuffer.Data) : -1;
+            item.m_Vertices.clear();
+
+            if (!batch.m_CallbackCmd) {
+                item.m_Vertices.reserve(batch.m_IdxCount);
+                ImGui_ImplEngine_GatherBatch(bd->m_FrameArena, batch, item.m_Vertices);
+            }
+        }
+
+        entry.m_Hash = hash;
+        entry.m_HasHash = true;
+        entry.m_Flags = bd->m_Flags;
+        // changed in the previous frame as well; likely to change again, so it is handed over instead of kept
+        entry.m_Valid = entry.m_ChangedFrames < 2;
+        entry.m_CommandCount = work.m_CommandCount;
+        entry.m_MergedCommandCount = work.m_MergedCommandCount;
+    }
+
+    static void ImGui_ImplEngine_SubmitRetained(ImGui_ImplEngine_Data *bd) {
+        bool mergeCommands = (bd->m_Flags & ImGui_RiftFlags_MergeCommands) != 0;
+
+        // pending item, kept open so compatible items of consecutive draw lists can still be merged
+        std::vector<core::runtime::graphics::Vertex> pending;
+        core::runtime::graphics::ITexture *pendingTexture = nullptr;
+        ImVec2 pendingClipMin, pendingClipMax;
+        uint32_t pendingListIdx = 0;
+        bool hasPending = false;
+
+        auto flushPending = [&]() {
+            if (hasPending) {
+                ImGui_ImplEngine_SubmitVertices(bd, pendingListIdx, std::move(pending), pendingTexture,
+                                                pendingClipMin, pendingClipMax);
+                pending = {};
+                hasPending = false;
+            }
+        };
+
+        for (size_t n = 0; n < bd->m_ListWork.size(); n++) {
+            const auto &work = bd->m_ListWork[n];
+            const ImDrawList *cmdList = work.m_CmdList;
+            auto &entry = *work.m_Retained;
+
+            bd->m_CommandCount += entry.m_CommandCount;
+            bd->m_MergedCommandCount += entry.m_MergedCommandCount;
+
+            if (work.m_Rebuilt) {
+                bd->m_RebuiltListCount++;
+            } else {
+                bd->m_RetainedListCount++;
+            }
+
+            for (auto &item: entry.m_Items) {
+                if (item.m_CallbackCmdIdx >= 0) {
+                    flushPending();
+
+                    const ImDrawCmd *cmdPtr = &cmdList->CmdBuffer[item.m_CallbackCmdIdx];
+                    cmdPtr->UserCallback(cmdList, cmdPtr);
+                    continue;
+                }
+
+                if (hasPending && mergeCommands &&
+                    ImGui_ImplEngine_CanMerge(pendingTexture, pendingClipMin, pendingClipMax,
+                                              item.m_Texture, item.m_ClipMin, item.m_ClipMax)) {
+                    pending.insert(pending.end(), item.m_Vertices.begin(), item.m_Vertices.end());
+                    bd->m_MergedCommandCount++;
+                    continue;
+                }
+
+                flushPending();
+
+                // the renderer takes ownership of what it is given; only vertices kept for later frames are copied
+                if (entry.m_Valid) {
+                    pending = item.m_Vertices;
+                } else {
+                    pending = std::move(item.m_Vertices);
+                }
+
+                pendingTexture = item.m_Texture;
+                pendingClipMin = item.m_ClipMin;
+                pendingClipMax = item.m_ClipMax;
+                pendingListIdx = (uint32_t) n;
+                hasPending = true;
+            }
+        }
+
+        flushPending();
+    }
+
+    static ImGui_ImplEngine_WorkerPool *ImGui_ImplEngine_GetWorkerPool() {
+        std::lock_guard lock(g_BackendLock);
+
+        if (!g_WorkerPool) {
+            // the render thread takes part in every loop, so one thread less than there are cores
+            int threadCount = (int) std::thread::hardware_concurrency() - 1;
+            g_WorkerPool = IM_NEW(ImGui_ImplEngine_WorkerPool)(ImClamp(threadCount, 0, 7));
+        }
+
+        return g_WorkerPool;
+    }
+
+    struct ImGui_ImplEngine_ConvertJob {
+        ImGui_ImplEngine_Data *m_Backend;
+        ImVec2 m_ClipOff;
+        ImVec2 m_ClipScale;
+    };
 
+    static void ImGui_ImplEngine_ConvertList(void *userData, int listIdx) {
+        auto job = (ImGui_ImplEngine_ConvertJob *) userData;
+        auto bd = job->m_Backend;
+        auto &work = bd->m_ListWork[listIdx];
+
+        if (work.m_Retained) {
+            ImGui_ImplEngine_ConvertRetained(bd, work, (uint32_t) listIdx, job->m_ClipOff, job->m_ClipScale);
+        } else {
+            ImGui_ImplEngine_BuildListBatches(bd, work, (uint32_t) listIdx, job->m_ClipOff, job->m_ClipScale);
+        }
+    }
+
+    // converts and submits the draw data of one viewport to the given renderer
+    static void ImGui_ImplEngine_RenderViewport(ImGui_ImplEngine_Data *bd, ImDrawData *drawData,
+                                                core::runtime::graphics::IRenderer *renderer) {
         auto fb_width = (int) (drawData->DisplaySize.x * drawData->FramebufferScale.x);
         auto fb_height = (int) (drawData->DisplaySize.y * drawData->FramebufferScale.y);
 
         if (fb_width == 0 || fb_height == 0) { return; }
 
-        auto io = ImGui::GetIO();
-
         auto clip_off = drawData->DisplayPos;
         auto clip_scale = drawData->FramebufferScale;
 
+        bool retained = (bd->m_Flags & ImGui_RiftFlags_RetainedSubmission) != 0;
+
+        bd->m_TargetRenderer = renderer;
+        bd->m_ListStatsBase = (uint32_t) bd->m_ListStats.size();
+        bd->m_ListStats.resize(bd->m_ListStatsBase + drawData->CmdListsCount);
+        bd->m_ListWork.resize(drawData->CmdListsCount);
+
+        // hand out the arena ranges (and retained entries) in list order; this is all the conversion shares
+        auto &arena = bd->m_FrameArena;
+
         for (int n = 0; n < drawData->CmdListsCount; n++) {
             const ImDrawList *cmdList = drawData->CmdLists[n];
+            auto &work = bd->m_ListWork[n];
 
-            for (int cmdIdx = 0; cmdIdx < cmdList->CmdBuffer.Size; cmdIdx++) {
-                const ImDrawCmd *cmdPtr = &cmdList->CmdBuffer[cmdIdx];
+            bd->m_ListStats[bd->m_ListStatsBase + n] = {
+                    cmdList->_OwnerName,
+                    (uint32_t) cmdList->VtxBuffer.Size,
+                    (uint32_t) cmdList->IdxBuffer.Size,
+                    (uint32_t) cmdList->CmdBuffer.Size,
+                    0
+            };
 
-                if (cmdPtr->UserCallback) {
-                    if (cmdPtr->UserCallback != ImDrawCallback_ResetRenderState) {
-                        cmdPtr->UserCallback(cmdList, cmdPtr);
-                    }
-                } else {
-                    // Project scissor/clipping rectangles into framebuffer space
-                    ImVec2 clip_min((cmdPtr->ClipRect.x - clip_off.x) * clip_scale.x,
-                                    (cmdPtr->ClipRect.y - clip_off.y) * clip_scale.y);
-                    ImVec2 clip_max((cmdPtr->ClipRect.z - clip_off.x) * clip_scale.x,
-                                    (cmdPtr->ClipRect.w - clip_off.y) * clip_scale.y);
-
-                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y) { continue; }
-
-                    std::vector<core::runtime::graphics::Vertex> vtxCollection(cmdPtr->ElemCount);
-
-                    const ImDrawIdx *indexBuffer = cmdList->IdxBuffer.Data + cmdPtr->IdxOffset;
-                    const ImDrawVert *vertexBuffer = cmdList->VtxBuffer.Data + cmdPtr->VtxOffset;
-
-                    // put vertices into the list
-                    for (int idxIdx = 0; idxIdx < cmdPtr->ElemCount; idxIdx++) {
-                        auto vtx = vertexBuffer[indexBuffer[idxIdx]];
-
-                        vtxCollection.emplace_back(core::runtime::graphics::Vertex{
-                                {vtx.pos.x, vtx.pos.y, 0.f},
-                                {vtx.uv.x,  1.f - vtx.uv.y},
-                                {0.f,       0.f,       0.f},
-                                {
-                                 (uint8_t) (vtx.col & 0xFF),
-                                            (uint8_t) ((vtx.col >> 8) & 0xFF),
-                                                       (uint8_t) ((vtx.col >> 16) & 0xFF),
-                                        (uint8_t) ((vtx.col >> 24) & 0xFF),
-                                }
-                        });
-                    }
+            work.m_CmdList = cmdList;
+            work.m_VtxBase = (uint32_t) arena.GetVertexCount();
+            work.m_VtxDst = arena.AllocVertices(cmdList->VtxBuffer.Size);
+            work.m_IdxBase = (uint32_t) arena.GetIndexCount();
+            work.m_IdxDst = arena.AllocIndices(cmdList->IdxBuffer.Size);
+            work.m_Retained = nullptr;
+            work.m_Rebuilt = false;
+
+            if (retained) {
+                work.m_Retained = &bd->m_RetainedLists[cmdList];
+                work.m_Retained->m_LastFrame = bd->m_FrameIndex;
+            }
+        }
+
+        ImGui_ImplEngine_ConvertJob job = {bd, clip_off, clip_scale};
+        bool parallel = (bd->m_Flags & ImGui_RiftFlags_ParallelConversion) && drawData->CmdListsCount > 1 &&
+                        (uint32_t) drawData->TotalVtxCount >= bd->m_ParallelThreshold;
+
+        if (parallel) {
+            auto pool = ImGui_ImplEngine_GetWorkerPool();
+            bd->m_ConversionThreadCount = (uint32_t) pool->GetThreadCount() + 1;
+            pool->ParallelFor(drawData->CmdListsCount, ImGui_ImplEngine_ConvertList, &job);
+        } else {
+            bd->m_ConversionThreadCount = 1;
+
+            for (int n = 0; n < drawData->CmdListsCount; n++) {
+                ImGui_ImplEngine_ConvertList(&job, n);
+            }
+        }
+
+        // submission and user callbacks stay on this thread, in draw order
+        if (retained) {
+            ImGui_ImplEngine_SubmitRetained(bd);
+        } else {
+            ImGui_ImplEngine_SubmitImmediate(bd);
+        }
+    }
+
+    void ImGui_ImplEngine_RenderDrawData(ImDrawData *drawData) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        // draw data only refers to the font texture, not the atlas; others may rebuild it from here on
+        if (bd->m_HoldsAtlasLock) {
+            bd->m_FontData->m_AtlasLock.unlock_shared();
+            bd->m_HoldsAtlasLock = false;
+        }
+
+        bd->m_Capture.WriteFrame(drawData, ImGui::GetFrameCount());
+
+        bd->m_FrameIndex++;
+        bd->m_WantCapture.store(ImGui::GetIO().WantCaptureMouse || ImGui::GetIO().WantCaptureKeyboard,
+                                std::memory_order_relaxed);
+
+        // the secondary viewports are rendered after this one into the same arena, so it is sized for all of them
+        size_t vtxCount = drawData->TotalVtxCount;
+        size_t idxCount = drawData->TotalIdxCount;
+
+        if (bd->m_ViewportsEnabled) {
+            const auto &viewports = ImGui::GetPlatformIO().Viewports;
 
-                    bd->m_Renderer->SubmitUI(engine::core::runtime::graphics::UIRenderItem{
-                            engine::core::runtime::graphics::PrimitiveType::PRIMITIVE_TYPE_TRIANGLES,
-                            std::move(vtxCollection),
-                            (core::runtime::graphics::ITexture *) cmdPtr->GetTexID(),
-                            {clip_min.x, clip_min.y},
-                            {clip_max.x - clip_min.x, clip_max.y - clip_min.y}
-                    });
+            for (int i = 1; i < viewports.Size; i++) {
+                if (viewports[i]->DrawData) {
+                    vtxCount += viewports[i]->DrawData->TotalVtxCount;
+                    idxCount += viewports[i]->DrawData->TotalIdxCount;
                 }
             }
         }
+
+        bd->m_FrameArena.BeginFrame(vtxCount, idxCount);
+
+        bd->m_CommandCount = 0;
+        bd->m_SubmittedCommandCount = 0;
+        bd->m_SubmittedVertexCount = 0;
+        bd->m_SubmitAllocationCount = 0;
+        bd->m_SubmitAllocatedBytes = 0;
+        bd->m_MergedCommandCount = 0;
+        bd->m_RetainedListCount = 0;
+        bd->m_RebuiltListCount = 0;
+        bd->m_ListStats.clear();
+
+        if (!(bd->m_Flags & ImGui_RiftFlags_RetainedSubmission)) {
+            bd->m_RetainedLists.clear();
+        } else {
+            // forget draw lists that were not rendered last frame (closed windows, hidden popups). checked a frame
+            // late, as the lists of the secondary viewports are only rendered after this
+            for (auto it = bd->m_RetainedLists.begin(); it != bd->m_RetainedLists.end();) {
+                if (it->second.m_LastFrame + 1 < bd->m_FrameIndex) {
+                    it = bd->m_RetainedLists.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        ImGui_ImplEngine_RenderViewport(bd, drawData, bd->m_Renderer);
+    }
+
+    static ImGui_ImplEngine_ViewportData *ImGui_ImplEngine_GetViewportData(ImGuiViewport *viewport) {
+        return (ImGui_ImplEngine_ViewportData *) viewport->PlatformUserData;
+    }
+
+    // null if the application failed to open a window for the viewport
+    static core::runtime::IWindow *ImGui_ImplEngine_GetViewportWindow(ImGuiViewport *viewport) {
+        auto vd = ImGui_ImplEngine_GetViewportData(viewport);
+        return vd && vd->m_GfxContext ? vd->m_GfxContext->GetOwnerWindow() : nullptr;
+    }
+
+    static void ImGui_ImplEngine_CreateWindow(ImGuiViewport *viewport) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        const auto &hooks = bd->m_ViewportHooks;
+
+        auto vd = IM_NEW(ImGui_ImplEngine_ViewportData)();
+        vd->m_WindowOwned = true;
+        viewport->PlatformUserData = vd;
+
+        if (!hooks.OpenWindow(viewport->Pos, viewport->Size, viewport->Flags, &vd->m_GfxContext, &vd->m_Renderer,
+                                hooks.UserData)) {
+            vd->m_GfxContext = nullptr;
+            vd->m_Renderer = nullptr;
+            return;
+        }
+
+        viewport->PlatformHandle = vd->m_GfxContext->GetOwnerWindow();
+    }
+
+    // also called for the main viewport, whose window is left alone
+    static void ImGui_ImplEngine_DestroyWindow(ImGuiViewport *viewport) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        const auto &hooks = bd->m_ViewportHooks;
+
+        if (auto vd = ImGui_ImplEngine_GetViewportData(viewport)) {
+            if (vd->m_WindowOwned && vd->m_GfxContext && hooks.CloseWindow) {
+                hooks.CloseWindow(vd->m_GfxContext, vd->m_Renderer, hooks.UserData);
+            }
+
+            IM_DELETE(vd);
+        }
+
+        viewport->PlatformUserData = nullptr;
+        viewport->PlatformHandle = nullptr;
+    }
+
+    static void ImGui_ImplEngine_ShowWindow(ImGuiViewport *viewport) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.ShowWindow) {
+            hooks.ShowWindow(window, hooks.UserData);
+        }
+    }
+
+    static ImVec2 ImGui_ImplEngine_GetWindowPos(ImGuiViewport *viewport) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.GetWindowPos) {
+            return hooks.GetWindowPos(window, hooks.UserData);
+        }
+
+        return viewport->Pos;
+    }
+
+    static void ImGui_ImplEngine_SetWindowPos(ImGuiViewport *viewport, ImVec2 pos) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.SetWindowPos) {
+            hooks.SetWindowPos(window, pos, hooks.UserData);
+        }
+    }
+
+    static ImVec2 ImGui_ImplEngine_GetWindowSize(ImGuiViewport *viewport) {
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport)) {
+            auto size = window->GetSize();
+            return {size.x, size.y};
+        }
+
+        return viewport->Size;
+    }
+
+    static void ImGui_ImplEngine_SetWindowSize(ImGuiViewport *viewport, ImVec2 size) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.SetWindowSize) {
+            hooks.SetWindowSize(window, size, hooks.UserData);
+        }
+    }
+
+    static void ImGui_ImplEngine_SetWindowTitle(ImGuiViewport *viewport, const char *title) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.SetWindowTitle) {
+            hooks.SetWindowTitle(window, title, hooks.UserData);
+        }
+    }
+
+    static void ImGui_ImplEngine_SetWindowFocus(ImGuiViewport *viewport) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.SetWindowFocus) {
+            hooks.SetWindowFocus(window, hooks.UserData);
+        }
+    }
+
+    static bool ImGui_ImplEngine_GetWindowFocus(ImGuiViewport *viewport) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.GetWindowFocus) {
+            return hooks.GetWindowFocus(window, hooks.UserData);
+        }
+
+        // without a way to ask, the main window is assumed to have focus
+        return viewport == ImGui::GetMainViewport();
+    }
+
+    static bool ImGui_ImplEngine_GetWindowMinimized(ImGuiViewport *viewport) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+
+        if (auto window = ImGui_ImplEngine_GetViewportWindow(viewport); window && hooks.GetWindowMinimized) {
+            return hooks.GetWindowMinimized(window, hooks.UserData);
+        }
+
+        return false;
+    }
+
+    static void ImGui_ImplEngine_RenderWindow(ImGuiViewport *viewport, void *) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        auto vd = ImGui_ImplEngine_GetViewportData(viewport);
+
+        if (vd && vd->m_Renderer && viewport->DrawData) {
+            ImGui_ImplEngine_RenderViewport(bd, viewport->DrawData, vd->m_Renderer);
+        }
+    }
+
+    static void ImGui_ImplEngine_SwapBuffers(ImGuiViewport *viewport, void *) {
+        const auto &hooks = ImGui_ImplEngine_GetBackendData()->m_ViewportHooks;
+        auto vd = ImGui_ImplEngine_GetViewportData(viewport);
+
+        if (vd && vd->m_GfxContext && hooks.PresentWindow) {
+            hooks.PresentWindow(vd->m_GfxContext, hooks.UserData);
+        }
+    }
+
+    static void ImGui_ImplEngine_UpdateMonitors(ImGui_ImplEngine_Data *bd) {
+        static constexpr int MAX_MONITORS = 16;
+
+        const auto &hooks = bd->m_ViewportHooks;
+        auto &monitors = ImGui::GetPlatformIO().Monitors;
+
+        ImGuiPlatformMonitor found[MAX_MONITORS];
+        int count = hooks.GetMonitors ? ImMin(hooks.GetMonitors(found, MAX_MONITORS, hooks.UserData), MAX_MONITORS) : 0;
+
+        // ImGui needs at least one monitor to place viewports on
+        if (count <= 0) {
+            ImGuiViewport *mainViewport = ImGui::GetMainViewport();
+
+            found[0] = ImGuiPlatformMonitor();
+            found[0].MainPos = found[0].WorkPos = ImGui_ImplEngine_GetWindowPos(mainViewport);
+            found[0].MainSize = found[0].WorkSize = ImGui_ImplEngine_GetDisplaySize(bd);
+            count = 1;
+        }
+
+        monitors.resize(count);
+
+        for (int i = 0; i < count; i++) {
+            monitors[i] = found[i];
+        }
+    }
+
+    // engine input events carry no window; they are taken to be relative to whichever viewport window has focus
+    static void ImGui_ImplEngine_UpdateMouseOrigin(ImGui_ImplEngine_Data *bd) {
+        const auto &viewports = ImGui::GetPlatformIO().Viewports;
+
+        for (int i = 1; i < viewports.Size; i++) {
+            if (ImGui_ImplEngine_GetViewportWindow(viewports[i]) && ImGui_ImplEngine_GetWindowFocus(viewports[i])) {
+                bd->m_MouseOrigin = ImGui_ImplEngine_GetWindowPos(viewports[i]);
+                return;
+            }
+        }
+
+        bd->m_MouseOrigin = ImGui_ImplEngine_GetWindowPos(ImGui::GetMainViewport());
+    }
+
+    bool ImGui_ImplEngine_EnableViewports(const ImGui_ViewportWindowHooks &hooks) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+        IM_ASSERT(hooks.OpenWindow != nullptr && "Viewports need a way to create windows!");
+
+        // a headless backend has no window to tear viewports out of
+        if (!bd->m_GfxContext || !hooks.OpenWindow) {
+            return false;
+        }
+
+        bd->m_ViewportHooks = hooks;
+
+        if (bd->m_ViewportsEnabled) {
+            return true;
+        }
+
+        ImGuiIO &io = ImGui::GetIO();
+        io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+        io.BackendFlags |= ImGuiBackendFlags_PlatformHasViewports | ImGuiBackendFlags_RendererHasViewports;
+
+        ImGuiPlatformIO &platformIO = ImGui::GetPlatformIO();
+        platformIO.Platform_CreateWindow = ImGui_ImplEngine_CreateWindow;
+        platformIO.Platform_DestroyWindow = ImGui_ImplEngine_DestroyWindow;
+        platformIO.Platform_ShowWindow = ImGui_ImplEngine_ShowWindow;
+        platformIO.Platform_SetWindowPos = ImGui_ImplEngine_SetWindowPos;
+        platformIO.Platform_GetWindowPos = ImGui_ImplEngine_GetWindowPos;
+        platformIO.Platform_SetWindowSize = ImGui_ImplEngine_SetWindowSize;
+        platformIO.Platform_GetWindowSize = ImGui_ImplEngine_GetWindowSize;
+        platformIO.Platform_SetWindowFocus = ImGui_ImplEngine_SetWindowFocus;
+        platformIO.Platform_GetWindowFocus = ImGui_ImplEngine_GetWindowFocus;
+        platformIO.Platform_GetWindowMinimized = ImGui_ImplEngine_GetWindowMinimized;
+        platformIO.Platform_SetWindowTitle = ImGui_ImplEngine_SetWindowTitle;
+        // a viewport is rendered like the main one, into its own window's renderer; the font texture is shared
+        platformIO.Renderer_RenderWindow = ImGui_ImplEngine_RenderWindow;
+        platformIO.Renderer_SwapBuffers = ImGui_ImplEngine_SwapBuffers;
+
+        auto vd = IM_NEW(ImGui_ImplEngine_ViewportData)();
+        vd->m_GfxContext = bd->m_GfxContext;
+        vd->m_Renderer = bd->m_Renderer;
+
+        ImGuiViewport *mainViewport = ImGui::GetMainViewport();
+        mainViewport->PlatformUserData = vd;
+        mainViewport->PlatformHandle = bd->m_GfxContext->GetOwnerWindow();
+
+        bd->m_ViewportsEnabled = true;
+        ImGui_ImplEngine_UpdateMonitors(bd);
+
+        return true;
+    }
+
+    void ImGui_ImplEngine_RenderPlatformWindows(bool frameBuilt) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        if (!bd->m_ViewportsEnabled) {
+            return;
+        }
+
+        // windows are only opened, moved or closed after a built frame; idle frames present them as they are
+        if (frameBuilt) {
+            ImGui::UpdatePlatformWindows();
+        }
+
+        ImGui::RenderPlatformWindowsDefault();
+    }
+
+    void ImGui_ImplEngine_GetRenderStats(ImGui_RenderStats &stats) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        const auto &arena = bd->m_FrameArena;
+        stats.ArenaVertexHighWater = arena.GetVertexHighWater();
+        stats.ArenaIndexHighWater = arena.GetIndexHighWater();
+        stats.ArenaCapacityBytes = arena.GetCapacityBytes();
+        stats.ArenaGrowCount = arena.GetGrowCount();
+        stats.ArenaFrameGrowCount = arena.GetFrameGrowCount();
+
+        stats.CommandCount = bd->m_CommandCount;
+        stats.SubmittedCommandCount = bd->m_SubmittedCommandCount;
+        stats.MergedCommandCount = bd->m_MergedCommandCount;
+        stats.SubmittedVertexCount = bd->m_SubmittedVertexCount;
+        stats.SubmitAllocationCount = bd->m_SubmitAllocationCount;
+        stats.SubmitAllocatedBytes = bd->m_SubmitAllocatedBytes;
+
+        stats.RetainedListCount = bd->m_RetainedListCount;
+        stats.RebuiltListCount = bd->m_RebuiltListCount;
+        stats.ConversionThreadCount = bd->m_ConversionThreadCount;
+
+        stats.TextureCount = bd->m_Textures.GetTextureCount();
+        stats.TextureResidentBytes = bd->m_Textures.GetResidentBytes();
+        stats.TextureUploadCount = bd->m_Textures.GetUploadCount();
+        stats.TextureEvictionCount = bd->m_Textures.GetEvictionCount();
+
+        stats.InputEventCount = bd->m_InputEventCount;
+        stats.CoalescedInputEventCount = bd->m_CoalescedInputEventCount;
+        stats.DroppedInputEventCount = bd->m_DroppedInputEventCount.load(std::memory_order_relaxed);
+
+        stats.CapturedFrameCount = bd->m_Capture.GetFrameCount();
+        stats.CaptureDroppedFrameCount = bd->m_Capture.GetDroppedFrameCount();
+    }
+
+    void ImGui_ImplEngine_GetTouchGesture(ImGui_TouchGesture &gesture) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        gesture.Active = bd->m_Touch.IsGestureActive();
+        gesture.ZoomDelta = bd->m_Touch.GetZoomDelta();
+        gesture.Center = bd->m_Touch.GetGestureCenter();
+    }
+
+    ImGui_ImplEngine_TextureRegistry &ImGui_ImplEngine_GetTextureRegistry() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        return bd->m_Textures;
+    }
+
+    bool ImGui_ImplEngine_StartCapture(const char *path) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_Capture.Stop();
+        return bd->m_Capture.Start(path);
+    }
+
+    void ImGui_ImplEngine_StopCapture() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_Capture.Stop();
+    }
+
+    void ImGui_ImplEngine_SetParallelThreshold(uint32_t vertexCount) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_ParallelThreshold = vertexCount;
+    }
+
+    void ImGui_ImplEngine_SetFlags(ImGui_RiftFlags flags) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_Flags = flags;
+    }
+
+    ImGui_RiftFlags ImGui_ImplEngine_GetFlags() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        return bd->m_Flags;
+    }
+
+    bool ImGui_ImplEngine_ConsumeActivity() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        ImGuiIO &io = ImGui::GetIO();
+        ImVec2 displaySize = ImGui_ImplEngine_GetDisplaySize(bd);
+
+        // exchange, so an event pushed by the input thread meanwhile is not lost
+        bool activity = bd->m_HasActivity.exchange(false, std::memory_order_acq_rel) || bd->m_Touch.IsAnimating() ||
+                        bd->m_Textures.HasPendingChanges() ||
+                        !io.Fonts->TexID ||
+                        displaySize.x != io.DisplaySize.x || displaySize.y != io.DisplaySize.y;
+
+        return activity;
+    }
+
+    void ImGui_ImplEngine_SetFrameClock(ImGui_FrameClockFn clock) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        // restart delta measurement, the new clock may use a different epoch
+        bd->m_FrameClock = clock;
+        bd->m_Time = 0.0;
+    }
+
+    const std::vector<ImGui_ImplEngine_ListStats> &ImGui_ImplEngine_GetListStats() {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        return bd->m_ListStats;
+    }
+
+    void ImGui_ImplEngine_SetSubmitHook(ImGui_ImplEngine_SubmitHook hook, void *userData) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_SubmitHook = hook;
+        bd->m_SubmitHookUserData = userData;
+    }
+
+    void ImGui_ImplEngine_SetHeadlessDisplaySize(ImVec2 size) {
+        ImGui_ImplEngine_Data *bd = ImGui_ImplEngine_GetBackendData();
+        IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplEngine_Init()?");
+
+        bd->m_HeadlessDisplaySize = size;
     }
 }
\ No newline at end of file
@@ -1,9 +1,28 @@
 #pragma once
 
+#include <vector>
+
 #include <Engine/Core/Runtime/Graphics/IGraphicsBackend.hpp>
 #include <Engine/Core/Runtime/Graphics/IRenderer.hpp>
 
+#include <Engine/UI/ImGui.hpp>
+
 namespace engine::ui {
+    struct ImGui_ImplEngine_TextureRegistry;
+
+    // what a single draw list contributed to the last rendered frame
+    struct ImGui_ImplEngine_ListStats {
+        // owning window name, only valid until the next frame
+        const char *m_Name;
+        uint32_t m_VtxCount;
+        uint32_t m_IdxCount;
+        uint32_t m_CmdCount;
+        uint32_t m_SubmitCount;
+    };
+
+    using ImGui_ImplEngine_SubmitHook = void (*)(core::runtime::graphics::UIRenderItem &&item, void *userData);
+
+    // gContext and renderer may both be null to run the backend headless, e.g. for benchmarks
     extern bool ImGui_ImplEngine_Init(core::runtime::graphics::IGraphicsContext *gContext, core::runtime::graphics::IRenderer* renderer);
 
     extern void ImGui_ImplEngine_Shutdown();
@@ -15,4 +34,51 @@ namespace engine::ui {
     extern void ImGui_ImplEngine_NewFrame();
 
     extern void ImGui_ImplEngine_RenderDrawData(ImDrawData *drawData);
+
+    extern bool ImGui_ImplEngine_EnableViewports(const ImGui_ViewportWindowHooks &hooks);
+
+    // updates and renders the windows of the secondary viewports; frameBuilt is false for idle frames, which only
+    // present them again
+    extern void ImGui_ImplEngine_RenderPlatformWindows(bool frameBuilt);
+
+    extern void ImGui_ImplEngine_GetRenderStats(ImGui_RenderStats &stats);
+
+    extern void ImGui_ImplEngine_GetTouchGesture(ImGui_TouchGesture &gesture);
+
+    extern ImGui_ImplEngine_TextureRegistry &ImGui_ImplEngine_GetTextureRegistry();
+
+    extern void ImGui_ImplEngine_SetFlags(ImGui_RiftFlags flags);
+
+    extern ImGui_RiftFlags ImGui_ImplEngine_GetFlags();
+
+    extern void ImGui_ImplEngine_SetParallelThreshold(uint32_t vertexCount);
+
+    // restarts the capture if one is already running
+    extern bool ImGui_ImplEngine_StartCapture(const char *path);
+    extern void ImGui_ImplEngine_StopCapture();
+
+    // content hash retained submission tells unchanged draw lists by; clip_off / clip_scale are part of it
+    extern uint64_t ImGui_ImplEngine_HashDrawList(const ImDrawList *cmdList, ImVec2 clip_off, ImVec2 clip_scale);
+
+    // true if input arrived or the display changed since the last call
+    extern bool ImGui_ImplEngine_ConsumeActivity();
+
+    extern void ImGui_ImplEngine_SetFrameClock(ImGui_FrameClockFn clock);
+
+    extern const std::vector<ImGui_ImplEngine_ListStats> &ImGui_ImplEngine_GetListStats();
+
+    // routes every UIRenderItem to hook instead of the renderer; nullptr restores normal submission
+    extern void ImGui_ImplEngine_SetSubmitHook(ImGui_ImplEngine_SubmitHook hook, void *userData);
+
+    extern void ImGui_ImplEngine_SetHeadlessDisplaySize(ImVec2 size);
+
+    // adds the glyphs of an UTF-8 string to the atlas; if any is missing, the whole atlas is rebuilt and its texture
+    // uploaded again before the next frame. thread-safe, atlas may be shared by several contexts
+    extern void ImGui_ImplEngine_RequestGlyphs(ImFontAtlas *atlas, const char *text);
+
+    // rebuilds the atlas and font texture before the next frame, e.g. after fonts were added
+    extern void ImGui_ImplEngine_InvalidateFontAtlas();
+
+    // makes the backend of the current context the one engine input is queued for
+    extern void ImGui_ImplEngine_SetInputFocus();
 }
\ No newline at end of file
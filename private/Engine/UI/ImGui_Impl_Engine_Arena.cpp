@@ -0,0 +1,54 @@
+#include <Engine/UI/ImGui_Impl_Engine_Arena.hpp>
+
+#include <imgui.h>
+
+namespace engine::ui {
+    void ImGui_ImplEngine_FrameArena::BeginFrame(size_t vtxCount, size_t idxCount) {
+        m_FrameGrowCount = 0;
+        m_VtxUsed = 0;
+        m_IdxUsed = 0;
+
+        // storage is never shrunk; reserving the whole frame up front keeps pointers handed out stable
+        if (m_Vertices.size() < vtxCount) {
+            m_Vertices.resize(vtxCount);
+            m_FrameGrowCount++;
+        }
+
+        if (m_Indices.size() < idxCount) {
+            m_Indices.resize(idxCount);
+            m_FrameGrowCount++;
+        }
+
+        m_GrowCount += m_FrameGrowCount;
+    }
+
+    core::runtime::graphics::Vertex *ImGui_ImplEngine_FrameArena::AllocVertices(size_t count) {
+        IM_ASSERT(m_VtxUsed + count <= m_Vertices.size() && "Frame arena vertex storage exhausted!");
+
+        auto ptr = m_Vertices.data() + m_VtxUsed;
+        m_VtxUsed += count;
+
+        if (m_VtxUsed > m_VtxHighWater) {
+            m_VtxHighWater = m_VtxUsed;
+        }
+
+        return ptr;
+    }
+
+    uint32_t *ImGui_ImplEngine_FrameArena::AllocIndices(size_t count) {
+        IM_ASSERT(m_IdxUsed + count <= m_Indices.size() && "Frame arena index storage exhausted!");
+
+        auto ptr = m_Indices.data() + m_IdxUsed;
+        m_IdxUsed += count;
+
+        if (m_IdxUsed > m_IdxHighWater) {
+            m_IdxHighWater = m_IdxUsed;
+        }
+
+        return ptr;
+    }
+
+    size_t ImGui_ImplEngine_FrameArena::GetCapacityBytes() const {
+        return m_Vertices.capacity() * sizeof(core::runtime::graphics::Vertex) + m_Indices.capacity() * sizeof(uint32_t);
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Engine/Core/Runtime/Graphics/Vertex.hpp>
+
+namespace engine::ui {
+    // grow-only staging storage for the converted draw data of a frame. it keeps its capacity between frames, so once
+    // the UI reached its largest frame no further heap allocations are made here. a single buffer is enough: the
+    // renderer never sees the arena, every UIRenderItem carries a copy of its vertices (see
+    // ImGui_RenderStats::SubmitAllocationCount), so nothing reads it once the frame it was filled for is submitted
+    struct ImGui_ImplEngine_FrameArena {
+        // resets the arena and makes sure it can hold the given amount of data without reallocating
+        void BeginFrame(size_t vtxCount, size_t idxCount);
+
+        core::runtime::graphics::Vertex *AllocVertices(size_t count);
+        uint32_t *AllocIndices(size_t count);
+
+        const core::runtime::graphics::Vertex *GetVertices() const { return m_Vertices.data(); }
+        const uint32_t *GetIndices() const { return m_Indices.data(); }
+
+        size_t GetVertexCount() const { return m_VtxUsed; }
+        size_t GetIndexCount() const { return m_IdxUsed; }
+
+        size_t GetVertexHighWater() const { return m_VtxHighWater; }
+        size_t GetIndexHighWater() const { return m_IdxHighWater; }
+        size_t GetCapacityBytes() const;
+
+        uint32_t GetGrowCount() const { return m_GrowCount; }
+        uint32_t GetFrameGrowCount() const { return m_FrameGrowCount; }
+    protected:
+        std::vector<core::runtime::graphics::Vertex> m_Vertices;
+        std::vector<uint32_t> m_Indices;
+        size_t m_VtxUsed = 0;
+        size_t m_IdxUsed = 0;
+
+        size_t m_VtxHighWater = 0;
+        size_t m_IdxHighWater = 0;
+        uint32_t m_GrowCount = 0;
+        uint32_t m_FrameGrowCount = 0;
+    };
+}
@@ -0,0 +1,564 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <Engine/UI/ImGui_Impl_Engine.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Capture.hpp>
+
+namespace engine::ui {
+    // how a draw command's user callback is stored; the callback itself cannot leave the process
+    enum ImGui_ImplEngine_CaptureCallback : uint8_t {
+        ImGui_ImplEngine_CaptureCallback_None = 0,
+        ImGui_ImplEngine_CaptureCallback_ResetRenderState = 1,
+        ImGui_ImplEngine_CaptureCallback_User = 2,
+    };
+
+    static void ImGui_ImplEngine_PutBytes(std::vector<uint8_t> &buffer, const void *data, size_t size) {
+        auto bytes = (const uint8_t *) data;
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    template<typename T>
+    static void ImGui_ImplEngine_Put(std::vector<uint8_t> &buffer, const T &value) {
+        ImGui_ImplEngine_PutBytes(buffer, &value, sizeof(T));
+    }
+
+    // returns where the record starts, for EndRecord to fill in its size
+    static size_t ImGui_ImplEngine_BeginRecord(std::vector<uint8_t> &buffer, ImGui_ImplEngine_CaptureTag tag) {
+        size_t start = buffer.size();
+
+        ImGui_ImplEngine_Put(buffer, (uint8_t) tag);
+        ImGui_ImplEngine_Put(buffer, (uint32_t) 0);
+
+        return start;
+    }
+
+    static void ImGui_ImplEngine_EndRecord(std::vector<uint8_t> &buffer, size_t start) {
+        auto size = (uint32_t) (buffer.size() - start - sizeof(uint8_t) - sizeof(uint32_t));
+        memcpy(buffer.data() + start + sizeof(uint8_t), &size, sizeof(size));
+    }
+
+    ImGui_ImplEngine_CaptureWriter::~ImGui_ImplEngine_CaptureWriter() {
+        Stop();
+    }
+
+    bool ImGui_ImplEngine_CaptureWriter::Start(const char *path) {
+        IM_ASSERT(!IsActive() && "A capture is already running!");
+
+        m_File = fopen(path, "wb");
+
+        if (!m_File) {
+            return false;
+        }
+
+        uint32_t header[3] = {CAPTURE_VERSION, (uint32_t) sizeof(ImDrawVert), (uint32_t) sizeof(ImDrawIdx)};
+        fwrite(CAPTURE_MAGIC, 1, sizeof(CAPTURE_MAGIC), m_File);
+        fwrite(header, 1, sizeof(header), m_File);
+
+        m_Lists.clear();
+        m_FreeListIds.clear();
+        m_NextListId = 0;
+        m_TextureIds.clear();
+        m_LastFrameCount = -1;
+        m_FrameCount = 0;
+        m_DroppedFrameCount = 0;
+
+        m_Pending.clear();
+        m_Quit = false;
+        m_StartTime = std::chrono::steady_clock::now();
+
+        m_Thread = std::thread(&ImGui_ImplEngine_CaptureWriter::WriterMain, this);
+        m_Active.store(true, std::memory_order_release);
+
+        return true;
+    }
+
+    void ImGui_ImplEngine_CaptureWriter::Stop() {
+        if (!IsActive()) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_Lock);
+            m_Active.store(false, std::memory_order_release);
+            m_Quit = true;
+        }
+
+        m_WakeCondition.notify_one();
+        m_Thread.join();
+
+        fclose(m_File);
+        m_File = nullptr;
+    }
+
+    double ImGui_ImplEngine_CaptureWriter::GetTime() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+    }
+
+    void ImGui_ImplEngine_CaptureWriter::WriterMain() {
+        std::unique_lock lock(m_Lock);
+
+        while (true) {
+            m_WakeCondition.wait(lock, [this]() { return m_Quit || !m_Pending.empty(); });
+
+            if (m_Pending.empty()) {
+                break;
+            }
+
+            m_Writing.clear();
+            std::swap(m_Writing, m_Pending);
+
+            lock.unlock();
+            fwrite(m_Writing.data(), 1, m_Writing.size(), m_File);
+            lock.lock();
+        }
+    }
+
+    void ImGui_ImplEngine_CaptureWriter::WriteFrame(const ImDrawData *drawData, int frameCount) {
+        if (!IsActive()) {
+            return;
+        }
+
+        m_Frame.clear();
+        m_HashUpdates.clear();
+
+        if (frameCount == m_LastFrameCount) {
+            size_t record = ImGui_ImplEngine_BeginRecord(m_Frame, ImGui_ImplEngine_CaptureTag_RepeatFrame);
+            ImGui_ImplEngine_Put(m_Frame, GetTime());
+            ImGui_ImplEngine_EndRecord(m_Frame, record);
+        } else {
+            // textures created and destroyed over a long capture would grow the table forever; starting over
+            // means every list is written again, so none refers to an index of the old table
+            if (m_TextureIds.size() > MAX_TEXTURE_IDS) {
+                m_TextureIds.clear();
+
+                for (auto &[list, state]: m_Lists) {
+                    state.m_Written = false;
+                }
+            }
+
+            size_t record = ImGui_ImplEngine_BeginRecord(m_Frame, ImGui_ImplEngine_CaptureTag_Frame);
+
+            ImGui_ImplEngine_Put(m_Frame, (uint32_t) frameCount);
+            ImGui_ImplEngine_Put(m_Frame, GetTime());
+            ImGui_ImplEngine_Put(m_Frame, drawData->DisplayPos);
+            ImGui_ImplEngine_Put(m_Frame, drawData->DisplaySize);
+            ImGui_ImplEngine_Put(m_Frame, drawData->FramebufferScale);
+            ImGui_ImplEngine_Put(m_Frame, (uint32_t) drawData->CmdListsCount);
+
+            for (int n = 0; n < drawData->CmdListsCount; n++) {
+                const ImDrawList *cmdList = drawData->CmdLists[n];
+                auto [it, inserted] = m_Lists.try_emplace(cmdList);
+                auto &state = it->second;
+
+                if (inserted) {
+                    if (!m_FreeListIds.empty()) {
+                        state.m_Id = m_FreeListIds.back();
+                        m_FreeListIds.pop_back();
+                    } else {
+                        state.m_Id = m_NextListId++;
+                    }
+
+                    state.m_Written = false;
+                }
+
+                state.m_LastFrame = frameCount;
+
+                uint64_t hash = ImGui_ImplEngine_HashDrawList(cmdList, {0.f, 0.f}, {1.f, 1.f});
+                bool changed = !state.m_Written || state.m_Hash != hash;
+
+                ImGui_ImplEngine_Put(m_Frame, state.m_Id);
+                ImGui_ImplEngine_Put(m_Frame, (uint8_t) changed);
+
+                if (!changed) {
+                    continue;
+                }
+
+                m_HashUpdates.emplace_back(&state, hash);
+
+                const char *name = cmdList->_OwnerName ? cmdList->_OwnerName : "";
+                auto nameLength = (uint16_t) std::min(strlen(name), (size_t) UINT16_MAX);
+
+                ImGui_ImplEngine_Put(m_Frame, (uint32_t) cmdList->VtxBuffer.Size);
+                ImGui_ImplEngine_Put(m_Frame, (uint32_t) cmdList->IdxBuffer.Size);
+                ImGui_ImplEngine_Put(m_Frame, (uint32_t) cmdList->CmdBuffer.Size);
+                ImGui_ImplEngine_Put(m_Frame, nameLength);
+                ImGui_ImplEngine_PutBytes(m_Frame, name, nameLength);
+                ImGui_ImplEngine_PutBytes(m_Frame, cmdList->VtxBuffer.Data, cmdList->VtxBuffer.Size * sizeof(ImDrawVert));
+#ifdef RIFT_IMGUI_ENGINE_VERTEX_LAYOUT
+                // z and the normal are never written by ImGui; cleared so the file holds no uninitialized memory
+                for (size_t at = m_Frame.size() - cmdList->VtxBuffer.Size * sizeof(ImDrawVert); at < m_Frame.size();
+                     at += sizeof(ImDrawVert)) {
+                    memset(m_Frame.data() + at + offsetof(ImDrawVert, z), 0, sizeof(float));
+                    memset(m_Frame.data() + at + offsetof(ImDrawVert, normal), 0, sizeof(float) * 3);
+                }
+#endif
+                ImGui_ImplEngine_PutBytes(m_Frame, cmdList->IdxBuffer.Data, cmdList->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+                for (const auto &cmd: cmdList->CmdBuffer) {
+                    auto [texIt, texInserted] = m_TextureIds.try_emplace(cmd.GetTexID(), (uint32_t) m_TextureIds.size());
+
+                    uint8_t callback = ImGui_ImplEngine_CaptureCallback_None;
+
+                    if (cmd.UserCallback == ImDrawCallback_ResetRenderState) {
+                        callback = ImGui_ImplEngine_CaptureCallback_ResetRenderState;
+                    } else if (cmd.UserCallback) {
+                        callback = ImGui_ImplEngine_CaptureCallback_User;
+                    }
+
+                    ImGui_ImplEngine_Put(m_Frame, cmd.ClipRect);
+                    ImGui_ImplEngine_Put(m_Frame, texIt->second);
+                    ImGui_ImplEngine_Put(m_Frame, (uint32_t) cmd.VtxOffset);
+                    ImGui_ImplEngine_Put(m_Frame, (uint32_t) cmd.IdxOffset);
+                    ImGui_ImplEngine_Put(m_Frame, (uint32_t) cmd.ElemCount);
+                    ImGui_ImplEngine_Put(m_Frame, callback);
+                }
+            }
+
+            ImGui_ImplEngine_EndRecord(m_Frame, record);
+
+            // forget lists that are gone, their ids are handed out again
+            for (auto it = m_Lists.begin(); it != m_Lists.end();) {
+                if (it->second.m_LastFrame != frameCount) {
+                    m_FreeListIds.push_back(it->second.m_Id);
+                    it = m_Lists.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        {
+            std::lock_guard lock(m_Lock);
+
+            // the disk cannot keep up; a dropped frame leaves the list states alone, so the next one is complete
+            if (m_Pending.size() + m_Frame.size() > MAX_PENDING_BYTES) {
+                m_DroppedFrameCount++;
+                return;
+            }
+
+            m_Pending.insert(m_Pending.end(), m_Frame.begin(), m_Frame.end());
+        }
+
+        m_WakeCondition.notify_one();
+
+        for (auto &[state, hash]: m_HashUpdates) {
+            state->m_Hash = hash;
+            state->m_Written = true;
+        }
+
+        m_LastFrameCount = frameCount;
+        m_FrameCount++;
+    }
+
+    void ImGui_ImplEngine_CaptureWriter::WriteInputEvent(const input::InputEvent &event) {
+        if (!IsActive()) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_Lock);
+
+            // stopped meanwhile, or the disk cannot keep up
+            if (!m_Active.load(std::memory_order_relaxed) || m_Pending.size() > MAX_PENDING_BYTES) {
+                return;
+            }
+
+            size_t record = ImGui_ImplEngine_BeginRecord(m_Pending, ImGui_ImplEngine_CaptureTag_InputEvent);
+
+            ImGui_ImplEngine_Put(m_Pending, GetTime());
+            ImGui_ImplEngine_Put(m_Pending, (uint8_t) event.Type);
+            ImGui_ImplEngine_Put(m_Pending, (uint16_t) event.UInputChar);
+            ImGui_ImplEngine_Put(m_Pending, (uint32_t) event.Key);
+            ImGui_ImplEngine_Put(m_Pending, (uint8_t) event.KeyState);
+            ImGui_ImplEngine_Put(m_Pending, (float) event.Position.x);
+            ImGui_ImplEngine_Put(m_Pending, (float) event.Position.y);
+            ImGui_ImplEngine_Put(m_Pending, (int32_t) event.TouchFinger);
+
+            ImGui_ImplEngine_EndRecord(m_Pending, record);
+        }
+
+        m_WakeCondition.notify_one();
+    }
+
+    // bounds-checked reads out of a record
+    struct ImGui_ImplEngine_CaptureCursor {
+        const uint8_t *m_Pos;
+        const uint8_t *m_End;
+
+        bool ReadBytes(void *dst, size_t size) {
+            if ((size_t) (m_End - m_Pos) < size) {
+                return false;
+            }
+
+            memcpy(dst, m_Pos, size);
+            m_Pos += size;
+            return true;
+        }
+
+        template<typename T>
+        bool Read(T &value) {
+            return ReadBytes(&value, sizeof(T));
+        }
+    };
+
+    // stands in for user callbacks of the captured process, keeping the batches split where they were
+    static void ImGui_ImplEngine_ReplayCallback(const ImDrawList *, const ImDrawCmd *) {}
+
+    ImGui_ImplEngine_CaptureReader::~ImGui_ImplEngine_CaptureReader() {
+        Close();
+    }
+
+    bool ImGui_ImplEngine_CaptureReader::Open(const char *path) {
+        Close();
+
+        m_File = fopen(path, "rb");
+
+        if (!m_File) {
+            return false;
+        }
+
+        char magic[4];
+        uint32_t header[3];
+
+        if (fread(magic, 1, sizeof(magic), m_File) != sizeof(magic) ||
+            fread(header, 1, sizeof(header), m_File) != sizeof(header) ||
+            memcmp(magic, CAPTURE_MAGIC, sizeof(magic)) != 0 || header[0] != CAPTURE_VERSION ||
+            header[1] != sizeof(ImDrawVert) || header[2] != sizeof(ImDrawIdx)) {
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void ImGui_ImplEngine_CaptureReader::Close() {
+        if (m_File) {
+            fclose(m_File);
+            m_File = nullptr;
+        }
+
+        for (auto &[id, list]: m_Lists) {
+            IM_DELETE(list.m_List);
+        }
+
+        m_Lists.clear();
+        m_DrawData.Clear();
+        m_HasFrame = false;
+    }
+
+    bool ImGui_ImplEngine_CaptureReader::NextFrame(ImDrawData *&drawData,
+                                                   std::vector<ImGui_ImplEngine_CapturedInput> &inputs) {
+        if (!m_File) {
+            return false;
+        }
+
+        while (true) {
+            uint8_t tag;
+            uint32_t size;
+
+            if (fread(&tag, 1, sizeof(tag), m_File) != sizeof(tag) ||
+                fread(&size, 1, sizeof(size), m_File) != sizeof(size)) {
+                return false;
+            }
+
+            m_Record.resize(size);
+
+            if (fread(m_Record.data(), 1, size, m_File) != size) {
+                return false;
+            }
+
+            ImGui_ImplEngine_CaptureCursor cursor = {m_Record.data(), m_Record.data() + size};
+
+            switch (tag) {
+                case ImGui_ImplEngine_CaptureTag_Frame:
+                    if (!ReadFrame(m_Record.data(), size)) {
+                        // the lists may hold part of the broken frame, nothing after it is read
+                        Close();
+                        return false;
+                    }
+
+                    drawData = &m_DrawData;
+                    return true;
+                case ImGui_ImplEngine_CaptureTag_RepeatFrame:
+                    if (!m_HasFrame || !cursor.Read(m_FrameTime)) {
+                        continue;
+                    }
+
+                    drawData = &m_DrawData;
+                    return true;
+                case ImGui_ImplEngine_CaptureTag_InputEvent: {
+                    ImGui_ImplEngine_CapturedInput input = {};
+                    uint8_t type, keyState;
+                    uint16_t inputChar;
+                    uint32_t key;
+                    float x, y;
+                    int32_t finger;
+
+                    if (cursor.Read(input.m_Time) && cursor.Read(type) && cursor.Read(inputChar) &&
+                        cursor.Read(key) && cursor.Read(keyState) && cursor.Read(x) && cursor.Read(y) &&
+                        cursor.Read(finger)) {
+                        input.m_Event.Type = (input::InputEventType) type;
+                        input.m_Event.UInputChar = inputChar;
+                        input.m_Event.Key = (input::InputKeyHandle) key;
+                        input.m_Event.KeyState = keyState != 0;
+                        input.m_Event.Position = {x, y};
+                        input.m_Event.TouchFinger = finger;
+                        inputs.push_back(input);
+                    }
+
+                    continue;
+                }
+                default:
+                    // written by a newer version; skip it
+                    continue;
+            }
+        }
+    }
+
+    bool ImGui_ImplEngine_CaptureReader::ReadFrame(const uint8_t *data, size_t size) {
+        ImGui_ImplEngine_CaptureCursor cursor = {data, data + size};
+        uint32_t frameCount, listCount;
+
+        m_DrawData.Clear();
+        m_HasFrame = false;
+
+        if (!cursor.Read(frameCount) || !cursor.Read(m_FrameTime) || !cursor.Read(m_DrawData.DisplayPos) ||
+            !cursor.Read(m_DrawData.DisplaySize) || !cursor.Read(m_DrawData.FramebufferScale) ||
+            !cursor.Read(listCount)) {
+            return false;
+        }
+
+        // every list takes at least its id and changed flag, more cannot be in the record
+        if (listCount > (size_t) (cursor.m_End - cursor.m_Pos) / (sizeof(uint32_t) + sizeof(uint8_t))) {
+            return false;
+        }
+
+        m_FramesRead++;
+
+        for (uint32_t n = 0; n < listCount; n++) {
+            uint32_t id;
+            uint8_t changed;
+
+            if (!cursor.Read(id) || !cursor.Read(changed)) {
+                return false;
+            }
+
+            auto [it, inserted] = m_Lists.try_emplace(id);
+            auto &list = it->second;
+
+            // a list new to the reader always comes with its content, and none is drawn twice in a frame
+            if (inserted) {
+                if (!changed) {
+                    m_Lists.erase(it);
+                    return false;
+                }
+
+                list.m_List = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+            } else if (list.m_LastFrame == m_FramesRead) {
+                return false;
+            }
+
+            list.m_LastFrame = m_FramesRead;
+            ImDrawList *cmdList = list.m_List;
+
+            if (changed) {
+                uint32_t vtxCount, idxCount, cmdCount;
+                uint16_t nameLength;
+
+                if (!cursor.Read(vtxCount) || !cursor.Read(idxCount) || !cursor.Read(cmdCount) ||
+                    !cursor.Read(nameLength)) {
+                    return false;
+                }
+
+                // sizes are checked against the record before anything is allocated for them
+                uint64_t listBytes = nameLength + (uint64_t) vtxCount * sizeof(ImDrawVert) +
+                                     (uint64_t) idxCount * sizeof(ImDrawIdx) +
+                                     (uint64_t) cmdCount * (sizeof(ImVec4) + 4 * sizeof(uint32_t) + sizeof(uint8_t));
+
+                if (listBytes > (uint64_t) (cursor.m_End - cursor.m_Pos) || vtxCount > INT32_MAX ||
+                    idxCount > INT32_MAX || cmdCount > INT32_MAX) {
+                    return false;
+                }
+
+                list.m_Name.resize(nameLength);
+                cmdList->VtxBuffer.resize((int) vtxCount);
+                cmdList->IdxBuffer.resize((int) idxCount);
+                cmdList->CmdBuffer.resize((int) cmdCount);
+
+                if (!cursor.ReadBytes(list.m_Name.data(), nameLength) ||
+                    !cursor.ReadBytes(cmdList->VtxBuffer.Data, vtxCount * sizeof(ImDrawVert)) ||
+                    !cursor.ReadBytes(cmdList->IdxBuffer.Data, idxCount * sizeof(ImDrawIdx))) {
+                    return false;
+                }
+
+                uint64_t elemTotal = 0;
+
+                for (auto &cmd: cmdList->CmdBuffer) {
+                    uint32_t texIdx, vtxOffset, idxOffset, elemCount;
+                    uint8_t callback;
+
+                    if (!cursor.Read(cmd.ClipRect) || !cursor.Read(texIdx) || !cursor.Read(vtxOffset) ||
+                        !cursor.Read(idxOffset) || !cursor.Read(elemCount) || !cursor.Read(callback)) {
+                        return false;
+                    }
+
+                    // never dereferenced by a backend without a renderer, they only have to tell textures apart
+                    cmd.TextureId = (ImTextureID) (intptr_t) (texIdx + 1);
+                    cmd.VtxOffset = vtxOffset;
+                    cmd.IdxOffset = idxOffset;
+                    cmd.ElemCount = elemCount;
+                    cmd.UserCallbackData = nullptr;
+
+                    // every index the command draws has to be in the list, or the backend reads past its buffers
+                    if ((uint64_t) idxOffset + elemCount > (uint64_t) idxCount) {
+                        return false;
+                    }
+
+                    for (uint32_t i = idxOffset; i < idxOffset + elemCount; i++) {
+                        if ((uint64_t) vtxOffset + cmdList->IdxBuffer.Data[i] >= (uint64_t) vtxCount) {
+                            return false;
+                        }
+                    }
+
+                    elemTotal += elemCount;
+
+                    if (callback == ImGui_ImplEngine_CaptureCallback_ResetRenderState) {
+                        cmd.UserCallback = ImDrawCallback_ResetRenderState;
+                    } else if (callback == ImGui_ImplEngine_CaptureCallback_User) {
+                        cmd.UserCallback = ImGui_ImplEngine_ReplayCallback;
+                    } else {
+                        cmd.UserCallback = nullptr;
+                    }
+                }
+
+                // ImGui never draws an index twice; the backend sizes its index ranges by the list
+                if (elemTotal > idxCount) {
+                    return false;
+                }
+            }
+
+            m_DrawData.CmdLists.push_back(cmdList);
+            m_DrawData.CmdListsCount++;
+            m_DrawData.TotalVtxCount += cmdList->VtxBuffer.Size;
+            m_DrawData.TotalIdxCount += cmdList->IdxBuffer.Size;
+        }
+
+        // lists missing from a frame were forgotten by the writer and their ids may come back with new content
+        for (auto it = m_Lists.begin(); it != m_Lists.end();) {
+            if (it->second.m_LastFrame != m_FramesRead) {
+                IM_DELETE(it->second.m_List);
+                it = m_Lists.erase(it);
+            } else {
+                it->second.m_List->_OwnerName = it->second.m_Name.c_str();
+                ++it;
+            }
+        }
+
+        m_DrawData.Valid = true;
+        m_HasFrame = true;
+
+        return true;
+    }
+}
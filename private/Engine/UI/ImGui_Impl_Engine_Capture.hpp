@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <Engine/Input/InputManager.hpp>
+
+#include <imgui.h>
+
+namespace engine::ui {
+    // capture files are a header followed by records of a tag byte and a 32-bit payload size, all in native byte
+    // order. frame payloads carry only the draw lists that changed; unchanged ones refer back to their last copy
+    static constexpr char CAPTURE_MAGIC[4] = {'R', 'I', 'M', 'C'};
+    static constexpr uint32_t CAPTURE_VERSION = 1;
+
+    enum ImGui_ImplEngine_CaptureTag : uint8_t {
+        ImGui_ImplEngine_CaptureTag_Frame = 1,
+        // an idle frame presenting the previous draw data again
+        ImGui_ImplEngine_CaptureTag_RepeatFrame = 2,
+        ImGui_ImplEngine_CaptureTag_InputEvent = 3,
+    };
+
+    // an input event as seen by ImGui_ImplEngine_OnInputEvent, time in seconds since the capture started
+    struct ImGui_ImplEngine_CapturedInput {
+        double m_Time;
+        input::InputEvent m_Event;
+    };
+
+    // streams the draw data of every frame and the engine input events to a file. serializing happens on the
+    // calling thread, disk writes on a thread of its own; a full backlog drops frames instead of stalling the UI
+    struct ImGui_ImplEngine_CaptureWriter {
+        // frames are dropped while this much is waiting to be written
+        static constexpr size_t MAX_PENDING_BYTES = 64 * 1024 * 1024;
+        // the texture id table starts over once it holds more than this
+        static constexpr size_t MAX_TEXTURE_IDS = 4096;
+
+        ImGui_ImplEngine_CaptureWriter() = default;
+        ~ImGui_ImplEngine_CaptureWriter();
+
+        ImGui_ImplEngine_CaptureWriter(const ImGui_ImplEngine_CaptureWriter &) = delete;
+        ImGui_ImplEngine_CaptureWriter &operator=(const ImGui_ImplEngine_CaptureWriter &) = delete;
+
+        bool Start(const char *path);
+        // flushes everything captured so far and closes the file
+        void Stop();
+
+        bool IsActive() const { return m_Active.load(std::memory_order_acquire); }
+
+        // UI thread only; frameCount tells built frames from idle ones presenting the same draw data again
+        void WriteFrame(const ImDrawData *drawData, int frameCount);
+        // any thread
+        void WriteInputEvent(const input::InputEvent &event);
+
+        uint32_t GetFrameCount() const { return m_FrameCount; }
+        uint32_t GetDroppedFrameCount() const { return m_DroppedFrameCount; }
+    protected:
+        struct ListState {
+            uint32_t m_Id;
+            uint64_t m_Hash;
+            // false until the content behind m_Hash made it into the file
+            bool m_Written;
+            int m_LastFrame;
+        };
+
+        void WriterMain();
+        double GetTime() const;
+
+        FILE *m_File = nullptr;
+        std::thread m_Thread;
+        std::atomic<bool> m_Active = false;
+        std::chrono::steady_clock::time_point m_StartTime;
+
+        // guards the pending buffer, which input events are written to directly
+        std::mutex m_Lock;
+        std::condition_variable m_WakeCondition;
+        std::vector<uint8_t> m_Pending;
+        bool m_Quit = false;
+
+        // writer thread only
+        std::vector<uint8_t> m_Writing;
+
+        // UI thread only
+        std::vector<uint8_t> m_Frame;
+        std::unordered_map<const ImDrawList *, ListState> m_Lists;
+        std::vector<uint32_t> m_FreeListIds;
+        uint32_t m_NextListId = 0;
+        // texture ids are pointers of this process; the file only keeps them apart
+        std::unordered_map<ImTextureID, uint32_t> m_TextureIds;
+        std::vector<std::pair<ListState *, uint64_t>> m_HashUpdates;
+        int m_LastFrameCount = -1;
+        uint32_t m_FrameCount = 0;
+        uint32_t m_DroppedFrameCount = 0;
+    };
+
+    // reads a capture back into draw data that can be handed to ImGui_ImplEngine_RenderDrawData. needs a current
+    // ImGui context for the draw lists; texture ids are small fake handles and user callbacks are replaced by no-ops
+    struct ImGui_ImplEngine_CaptureReader {
+        ImGui_ImplEngine_CaptureReader() = default;
+        ~ImGui_ImplEngine_CaptureReader();
+
+        ImGui_ImplEngine_CaptureReader(const ImGui_ImplEngine_CaptureReader &) = delete;
+        ImGui_ImplEngine_CaptureReader &operator=(const ImGui_ImplEngine_CaptureReader &) = delete;
+
+        // false if the file is missing, not a capture, or recorded with a different ImDrawVert / ImDrawIdx
+        bool Open(const char *path);
+        void Close();
+
+        // reads up to the next frame; the input events before it are appended to inputs. the draw data stays
+        // valid until the next call. false at the end of the file or on a truncated record
+        bool NextFrame(ImDrawData *&drawData, std::vector<ImGui_ImplEngine_CapturedInput> &inputs);
+
+        double GetFrameTime() const { return m_FrameTime; }
+    protected:
+        struct ListState {
+            ImDrawList *m_List;
+            std::string m_Name;
+            uint32_t m_LastFrame;
+        };
+
+        bool ReadFrame(const uint8_t *data, size_t size);
+
+        FILE *m_File = nullptr;
+        std::vector<uint8_t> m_Record;
+
+        ImDrawData m_DrawData;
+        double m_FrameTime = 0.0;
+        bool m_HasFrame = false;
+        uint32_t m_FramesRead = 0;
+        // by the list ids of the file; only the lists of the last frame are kept, like the writer does
+        std::unordered_map<uint32_t, ListState> m_Lists;
+    };
+}
@@ -0,0 +1,56 @@
+#include <Engine/UI/ImGui_Impl_Engine_InputQueue.hpp>
+
+namespace engine::ui {
+    static_assert((ImGui_ImplEngine_InputQueue::CAPACITY & (ImGui_ImplEngine_InputQueue::CAPACITY - 1)) == 0,
+                  "Input queue capacity must be a power of two!");
+
+    ImGui_ImplEngine_InputQueue::ImGui_ImplEngine_InputQueue() {
+        // a cell is free for the push at position p while its sequence equals p
+        for (uint32_t i = 0; i < CAPACITY; i++) {
+            m_Cells[i].m_Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool ImGui_ImplEngine_InputQueue::Push(const input::InputEvent &event) {
+        uint32_t pos = m_PushPos.load(std::memory_order_relaxed);
+        Cell *cell;
+
+        for (;;) {
+            cell = &m_Cells[pos & (CAPACITY - 1)];
+            auto diff = (int32_t) (cell->m_Sequence.load(std::memory_order_acquire) - pos);
+
+            if (diff == 0) {
+                // claim the cell; on failure pos is reloaded and we retry with the next free one
+                if (m_PushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the consumer has not released this cell yet: full
+                return false;
+            } else {
+                pos = m_PushPos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->m_Event = event;
+        cell->m_Sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool ImGui_ImplEngine_InputQueue::Pop(input::InputEvent &event) {
+        uint32_t pos = m_PopPos.load(std::memory_order_relaxed);
+        Cell &cell = m_Cells[pos & (CAPACITY - 1)];
+
+        // a published cell carries pos + 1; anything else means its producer is not done yet
+        if ((int32_t) (cell.m_Sequence.load(std::memory_order_acquire) - (pos + 1)) < 0) {
+            return false;
+        }
+
+        event = cell.m_Event;
+        cell.m_Sequence.store(pos + CAPACITY, std::memory_order_release);
+        m_PopPos.store(pos + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+}
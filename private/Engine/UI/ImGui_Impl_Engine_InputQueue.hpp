@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <Engine/Input/InputManager.hpp>
+
+namespace engine::ui {
+    // bounded lock-free queue of raw input events. any number of threads may push, only the UI thread pops;
+    // neither side ever blocks. when the UI falls behind by a full queue, new events are rejected rather than
+    // overwriting ones that were not seen yet
+    struct ImGui_ImplEngine_InputQueue {
+        static constexpr uint32_t CAPACITY = 1024;
+
+        ImGui_ImplEngine_InputQueue();
+
+        bool Push(const input::InputEvent &event);
+        bool Pop(input::InputEvent &event);
+    protected:
+        struct Cell {
+            // tells producers and the consumer whose turn it is on this cell, see Push / Pop
+            std::atomic<uint32_t> m_Sequence;
+            input::InputEvent m_Event;
+        };
+
+        Cell m_Cells[CAPACITY];
+
+        // producers and the consumer each hammer their own position; keep them on separate cache lines
+        std::atomic<uint32_t> m_PushPos = 0;
+        uint8_t m_Padding[64 - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint32_t> m_PopPos = 0;
+    };
+}
@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Engine/UI/ImGui_Impl_Engine_Textures.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_VertexConvert.hpp>
+
+namespace engine::ui {
+    ImGui_ImplEngine_TextureRegistry::~ImGui_ImplEngine_TextureRegistry() {
+        // whatever is still referenced goes with the backend. released textures stay in m_Textures until the next
+        // ApplyStagedUpdates, so m_Released holds no texture of its own
+        for (auto list: {&m_Textures, &m_Dying}) {
+            for (auto texture: *list) {
+                if (texture->m_Resident && texture->m_Texture) {
+                    texture->m_Texture->Destroy();
+                }
+
+                IM_DELETE(texture);
+            }
+        }
+    }
+
+    ImGui_RiftTexture *ImGui_ImplEngine_TextureRegistry::Create(int width, int height,
+                                                                const core::runtime::graphics::Color *pixels) {
+        IM_ASSERT(width > 0 && height > 0 && "Invalid texture size!");
+
+        auto texture = IM_NEW(ImGui_RiftTexture)();
+        texture->m_Registry = this;
+        texture->m_Width = width;
+        texture->m_Height = height;
+        texture->m_LastUsedFrame = m_Frame;
+
+        if (pixels) {
+            texture->m_Pixels.assign(pixels, pixels + (size_t) width * height);
+        } else {
+            texture->m_Pixels.resize((size_t) width * height, {0, 0, 0, 0});
+        }
+
+        // uploaded the first time it is drawn
+        m_Textures.push_back(texture);
+
+        return texture;
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::AddRef(ImGui_RiftTexture *texture) {
+        texture->m_RefCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::Release(ImGui_RiftTexture *texture) {
+        if (texture->m_RefCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        std::lock_guard lock(m_Lock);
+        m_Released.push_back(texture);
+        m_PendingChanges.store(true, std::memory_order_release);
+    }
+
+    bool ImGui_ImplEngine_TextureRegistry::Update(ImGui_RiftTexture *texture, int x, int y, int width, int height,
+                                                  const core::runtime::graphics::Color *pixels, int stride) {
+        if (width <= 0 || height <= 0 || x < 0 || y < 0 ||
+            x + width > texture->m_Width || y + height > texture->m_Height) {
+            return false;
+        }
+
+        if (stride == 0) {
+            stride = width;
+        }
+
+        std::lock_guard lock(m_Lock);
+
+        size_t offset = m_StagedPixels.size();
+        m_StagedPixels.resize(offset + (size_t) width * height);
+
+        for (int row = 0; row < height; row++) {
+            memcpy(&m_StagedPixels[offset + (size_t) row * width], pixels + (size_t) row * stride,
+                   width * sizeof(core::runtime::graphics::Color));
+        }
+
+        m_Staged.push_back({texture, x, y, width, height, offset});
+        m_PendingChanges.store(true, std::memory_order_release);
+
+        return true;
+    }
+
+    ImTextureID ImGui_ImplEngine_TextureRegistry::Use(ImGui_RiftTexture *texture) {
+        texture->m_LastUsedFrame = m_Frame;
+
+        // images only reach the GPU once drawn; streams nobody looks at cost no uploads
+        if (!texture->m_Resident || texture->m_Dirty) {
+            Upload(texture);
+        }
+
+        // headless backends only need an id that is not null
+        return texture->m_Texture ? (ImTextureID) texture->m_Texture.get() : (ImTextureID) texture;
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::Upload(ImGui_RiftTexture *texture) {
+        texture->m_Dirty = false;
+
+        if (!m_Backend) {
+            texture->m_Resident = true;
+            return;
+        }
+
+        // the engine texture has no sub-rect upload; it is refilled in place as a whole, keeping its id
+        if (!texture->m_Texture) {
+            texture->m_Texture = m_Backend->CreateTexture();
+            IM_ASSERT(texture->m_Texture != nullptr && "Failed to create texture!");
+        } else if (texture->m_Resident) {
+            texture->m_Texture->Destroy();
+        }
+
+        // the CPU copy stays as the application wrote it; updates are applied to it
+        std::vector<core::runtime::graphics::Color> pixels = texture->m_Pixels;
+        ImGui_ImplEngine_OrientTexturePixels(pixels, texture->m_Width, texture->m_Height);
+
+        texture->m_Texture->Create({
+                                           std::move(pixels),
+                                           {
+                                                   (float) texture->m_Width,
+                                                   (float) texture->m_Height
+                                           }
+                                   });
+
+        if (!texture->m_Resident) {
+            texture->m_Resident = true;
+            m_ResidentBytes += texture->m_Pixels.size() * sizeof(core::runtime::graphics::Color);
+        }
+
+        m_UploadCount++;
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::Evict(ImGui_RiftTexture *texture) {
+        if (!texture->m_Resident) {
+            return;
+        }
+
+        if (texture->m_Texture) {
+            texture->m_Texture->Destroy();
+            m_ResidentBytes -= texture->m_Pixels.size() * sizeof(core::runtime::graphics::Color);
+        }
+
+        texture->m_Resident = false;
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::ApplyStagedUpdates() {
+        std::vector<ImGui_RiftTexture *> released;
+
+        {
+            std::lock_guard lock(m_Lock);
+            std::swap(m_Staged, m_Applying);
+            std::swap(m_StagedPixels, m_ApplyingPixels);
+            std::swap(m_Released, released);
+            m_PendingChanges.store(false, std::memory_order_release);
+        }
+
+        for (const auto &update: m_Applying) {
+            auto texture = update.m_Texture;
+
+            for (int row = 0; row < update.m_Height; row++) {
+                memcpy(&texture->m_Pixels[(size_t) (update.m_Y + row) * texture->m_Width + update.m_X],
+                       &m_ApplyingPixels[update.m_Offset + (size_t) row * update.m_Width],
+                       update.m_Width * sizeof(core::runtime::graphics::Color));
+            }
+
+            texture->m_Dirty = true;
+        }
+
+        m_Applying.clear();
+        m_ApplyingPixels.clear();
+
+        for (auto texture: released) {
+            texture->m_ReleasedFrame = m_Frame;
+            m_Textures.erase(std::find(m_Textures.begin(), m_Textures.end(), texture));
+            m_Dying.push_back(texture);
+        }
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::FreeReleased() {
+        for (size_t i = 0; i < m_Dying.size();) {
+            auto texture = m_Dying[i];
+
+            if (texture->m_ReleasedFrame + FRAMES_IN_FLIGHT > m_Frame) {
+                i++;
+                continue;
+            }
+
+            Evict(texture);
+            IM_DELETE(texture);
+
+            m_Dying[i] = m_Dying.back();
+            m_Dying.pop_back();
+        }
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::EnforceBudget() {
+        if (m_Budget == 0 || m_ResidentBytes <= m_Budget) {
+            return;
+        }
+
+        // least recently used first; anything drawn by a frame that may still be in flight stays
+        std::vector<ImGui_RiftTexture *> candidates;
+
+        for (auto texture: m_Textures) {
+            if (texture->m_Resident &&
+                texture->m_LastUsedFrame + FRAMES_IN_FLIGHT <= m_Frame) {
+                candidates.push_back(texture);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [](ImGui_RiftTexture *a, ImGui_RiftTexture *b) {
+            return a->m_LastUsedFrame < b->m_LastUsedFrame;
+        });
+
+        for (auto texture: candidates) {
+            if (m_ResidentBytes <= m_Budget) {
+                break;
+            }
+
+            Evict(texture);
+            m_EvictionCount++;
+        }
+    }
+
+    void ImGui_ImplEngine_TextureRegistry::BeginFrame() {
+        m_Frame++;
+        m_UploadCount = 0;
+
+        ApplyStagedUpdates();
+        FreeReleased();
+        EnforceBudget();
+    }
+}
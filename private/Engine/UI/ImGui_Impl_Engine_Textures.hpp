@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Engine/Core/Runtime/Graphics/IGraphicsBackend.hpp>
+#include <Engine/Core/Runtime/Graphics/ITexture.hpp>
+
+#include <Engine/UI/ImGui.hpp>
+
+namespace engine::ui {
+    struct ImGui_ImplEngine_TextureRegistry;
+
+    // an image registered for ImGui::Image. the pixels are kept on the CPU: updates are applied to them and the
+    // engine texture is refilled from them, both after sub-rect updates and when an evicted image is used again
+    struct ImGui_RiftTexture {
+        ImGui_ImplEngine_TextureRegistry *m_Registry;
+        int m_Width;
+        int m_Height;
+        std::vector<core::runtime::graphics::Color> m_Pixels;
+
+        // created once and only refilled afterwards, so the ImTextureID handed out stays valid while evicted
+        std::unique_ptr<core::runtime::graphics::ITexture> m_Texture;
+        bool m_Resident = false;
+        // pixels changed since the last upload
+        bool m_Dirty = false;
+
+        std::atomic<int> m_RefCount = 1;
+        uint32_t m_LastUsedFrame = 0;
+        // frame the last reference was dropped in; the texture may still be drawn by frames in flight until then
+        uint32_t m_ReleasedFrame = 0;
+    };
+
+    // the images of one backend. creating and using images belongs to the thread building the frames; updating,
+    // referencing and releasing them may happen on any thread, it is staged and applied by the next BeginFrame
+    struct ImGui_ImplEngine_TextureRegistry {
+        // frames the renderer may still be drawing after they were submitted; a texture they used is kept that long
+        static constexpr uint32_t FRAMES_IN_FLIGHT = 3;
+
+        ImGui_ImplEngine_TextureRegistry() = default;
+        ~ImGui_ImplEngine_TextureRegistry();
+
+        ImGui_ImplEngine_TextureRegistry(const ImGui_ImplEngine_TextureRegistry &) = delete;
+        ImGui_ImplEngine_TextureRegistry &operator=(const ImGui_ImplEngine_TextureRegistry &) = delete;
+
+        // null for headless backends, whose images never leave the CPU
+        void SetGraphicsBackend(core::runtime::graphics::IGraphicsBackend *backend) { m_Backend = backend; }
+
+        ImGui_RiftTexture *Create(int width, int height, const core::runtime::graphics::Color *pixels);
+        void AddRef(ImGui_RiftTexture *texture);
+        void Release(ImGui_RiftTexture *texture);
+
+        // copies a rect of pixels (stride in pixels, 0 for tightly packed) to be applied by the next BeginFrame
+        bool Update(ImGui_RiftTexture *texture, int x, int y, int width, int height,
+                    const core::runtime::graphics::Color *pixels, int stride);
+
+        // marks the image as used by the frame being built and makes sure its texture is uploaded
+        ImTextureID Use(ImGui_RiftTexture *texture);
+
+        // applies staged updates, frees released images and evicts the least recently used ones over the budget
+        void BeginFrame();
+
+        // bytes of uploaded images before unused ones get evicted; 0 means no limit
+        void SetBudget(size_t bytes) { m_Budget = bytes; }
+
+        // true while updates or releases wait for BeginFrame, so an idle UI builds a frame to apply them
+        bool HasPendingChanges() const { return m_PendingChanges.load(std::memory_order_acquire); }
+
+        uint32_t GetTextureCount() const { return (uint32_t) m_Textures.size(); }
+        size_t GetResidentBytes() const { return m_ResidentBytes; }
+        uint32_t GetUploadCount() const { return m_UploadCount; }
+        uint32_t GetEvictionCount() const { return m_EvictionCount; }
+    protected:
+        struct StagedUpdate {
+            ImGui_RiftTexture *m_Texture;
+            int m_X, m_Y, m_Width, m_Height;
+            // first pixel in the staging buffer
+            size_t m_Offset;
+        };
+
+        void Upload(ImGui_RiftTexture *texture);
+        void Evict(ImGui_RiftTexture *texture);
+        void ApplyStagedUpdates();
+        void FreeReleased();
+        void EnforceBudget();
+
+        core::runtime::graphics::IGraphicsBackend *m_Backend = nullptr;
+        std::vector<ImGui_RiftTexture *> m_Textures;
+
+        // guards the staging buffers and the released list
+        std::mutex m_Lock;
+        std::vector<StagedUpdate> m_Staged;
+        std::vector<core::runtime::graphics::Color> m_StagedPixels;
+        std::vector<ImGui_RiftTexture *> m_Released;
+        std::atomic<bool> m_PendingChanges = false;
+
+        // swapped with the staging buffers by BeginFrame, so producers never wait for an update being applied
+        std::vector<StagedUpdate> m_Applying;
+        std::vector<core::runtime::graphics::Color> m_ApplyingPixels;
+        // released images waiting for the frames in flight to let go of them
+        std::vector<ImGui_RiftTexture *> m_Dying;
+
+        uint32_t m_Frame = 0;
+        size_t m_Budget = 0;
+        size_t m_ResidentBytes = 0;
+        uint32_t m_UploadCount = 0;
+        uint32_t m_EvictionCount = 0;
+    };
+}
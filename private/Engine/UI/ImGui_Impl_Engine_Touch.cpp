@@ -0,0 +1,194 @@
+#include <Engine/UI/ImGui_Impl_Engine_Touch.hpp>
+
+#include <cfloat>
+#include <cmath>
+
+namespace engine::ui {
+    // inertia decays by e^-INERTIA_FRICTION per second and stops below INERTIA_MIN_SPEED pixels per second
+    static constexpr float INERTIA_FRICTION = 4.f;
+    static constexpr float INERTIA_MIN_SPEED = 20.f;
+
+    // ImGui scrolls about five lines per wheel step; convert finger travel so content follows the fingers
+    static float ImGui_ImplEngine_GetWheelStepPixels(ImGuiIO &io) {
+        float fontSize = io.Fonts->Fonts.Size > 0 ? io.Fonts->Fonts[0]->FontSize : 13.f;
+        return 5.f * fontSize * io.FontGlobalScale;
+    }
+
+    ImGui_ImplEngine_TouchState::Touch *ImGui_ImplEngine_TouchState::FindTouch(int fingerId) {
+        for (int i = 0; i < m_TouchCount; i++) {
+            if (m_Touches[i].m_Id == fingerId) {
+                return &m_Touches[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // the gesture follows the first two fingers; re-anchor whenever they change so nothing jumps
+    void ImGui_ImplEngine_TouchState::ResetGestureAnchor() {
+        if (m_TouchCount < 2) {
+            return;
+        }
+
+        ImVec2 a = m_Touches[0].m_Position;
+        ImVec2 b = m_Touches[1].m_Position;
+
+        m_GestureCenter = {(a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f};
+        m_GestureSpan = sqrtf((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+    }
+
+    void ImGui_ImplEngine_TouchState::EmitScroll(ImGuiIO &io, ImVec2 delta) {
+        if (delta.x == 0.f && delta.y == 0.f) {
+            return;
+        }
+
+        float step = ImGui_ImplEngine_GetWheelStepPixels(io);
+        io.AddMouseWheelEvent(delta.x / step, delta.y / step);
+    }
+
+    void ImGui_ImplEngine_TouchState::OnTouchDown(ImGuiIO &io, int fingerId, ImVec2 position) {
+        // any touch catches a gliding scroll
+        m_Velocity = {0.f, 0.f};
+
+        if (Touch *touch = FindTouch(fingerId)) {
+            touch->m_Position = position;
+            return;
+        }
+
+        if (m_TouchCount == MAX_TOUCHES) {
+            return;
+        }
+
+        m_Touches[m_TouchCount++] = {fingerId, position};
+        io.AddMouseSourceEvent(ImGuiMouseSource_TouchScreen);
+
+        if (m_TouchCount == 1) {
+            m_PrimaryId = fingerId;
+            io.AddMousePosEvent(position.x, position.y);
+            io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+            return;
+        }
+
+        if (!m_Gesture) {
+            // cancel the press of the first finger without clicking: release it with the mouse off screen
+            if (m_PrimaryId != -1) {
+                io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+                io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+                m_PrimaryId = -1;
+            }
+
+            m_Gesture = true;
+        }
+
+        ResetGestureAnchor();
+        io.AddMousePosEvent(m_GestureCenter.x, m_GestureCenter.y);
+    }
+
+    void ImGui_ImplEngine_TouchState::OnTouchMove(ImGuiIO &io, int fingerId, ImVec2 position) {
+        Touch *touch = FindTouch(fingerId);
+
+        if (!touch) {
+            return;
+        }
+
+        touch->m_Position = position;
+
+        if (fingerId == m_PrimaryId) {
+            io.AddMouseSourceEvent(ImGuiMouseSource_TouchScreen);
+            io.AddMousePosEvent(position.x, position.y);
+            return;
+        }
+
+        // only the first two fingers steer a gesture
+        if (!m_Gesture || m_TouchCount < 2 || touch - m_Touches > 1) {
+            return;
+        }
+
+        ImVec2 previousCenter = m_GestureCenter;
+        float previousSpan = m_GestureSpan;
+        ResetGestureAnchor();
+
+        ImVec2 delta = {m_GestureCenter.x - previousCenter.x, m_GestureCenter.y - previousCenter.y};
+        m_FrameScroll.x += delta.x;
+        m_FrameScroll.y += delta.y;
+
+        if (previousSpan > 0.f && m_GestureSpan > 0.f) {
+            m_FrameZoom *= m_GestureSpan / previousSpan;
+        }
+
+        // keep the mouse under the fingers so the window beneath them receives the wheel
+        io.AddMouseSourceEvent(ImGuiMouseSource_TouchScreen);
+        io.AddMousePosEvent(m_GestureCenter.x, m_GestureCenter.y);
+        EmitScroll(io, delta);
+    }
+
+    void ImGui_ImplEngine_TouchState::OnTouchUp(ImGuiIO &io, int fingerId, ImVec2 position) {
+        Touch *touch = FindTouch(fingerId);
+
+        if (!touch) {
+            return;
+        }
+
+        if (fingerId == m_PrimaryId) {
+            io.AddMouseSourceEvent(ImGuiMouseSource_TouchScreen);
+            io.AddMousePosEvent(position.x, position.y);
+            io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+            m_PrimaryId = -1;
+        }
+
+        // keep the order of the remaining fingers so the gesture pair stays the same
+        for (int i = (int) (touch - m_Touches); i + 1 < m_TouchCount; i++) {
+            m_Touches[i] = m_Touches[i + 1];
+        }
+
+        m_TouchCount--;
+
+        if (m_TouchCount == 0) {
+            m_Gesture = false;
+        } else {
+            ResetGestureAnchor();
+        }
+    }
+
+    void ImGui_ImplEngine_TouchState::OnHover(ImGuiIO &io, ImVec2 position) {
+        if (m_TouchCount > 0) {
+            return;
+        }
+
+        io.AddMouseSourceEvent(ImGuiMouseSource_TouchScreen);
+        io.AddMousePosEvent(position.x, position.y);
+    }
+
+    void ImGui_ImplEngine_TouchState::Update(ImGuiIO &io, float deltaTime) {
+        m_ZoomDelta = m_FrameZoom;
+        m_FrameZoom = 1.f;
+
+        if (m_Gesture && m_TouchCount >= 2) {
+            // smoothed over a couple of frames, so a single jittery event does not decide the fling
+            m_Velocity.x = m_Velocity.x * 0.5f + (m_FrameScroll.x / deltaTime) * 0.5f;
+            m_Velocity.y = m_Velocity.y * 0.5f + (m_FrameScroll.y / deltaTime) * 0.5f;
+            m_FrameScroll = {0.f, 0.f};
+            return;
+        }
+
+        m_FrameScroll = {0.f, 0.f};
+
+        if (!IsAnimating()) {
+            return;
+        }
+
+        // fingers are rarely lifted in the same frame; while the last one is still down the fling only decays,
+        // so a quick release keeps most of its speed and a slow one ends up not gliding at all
+        if (m_TouchCount == 0) {
+            EmitScroll(io, {m_Velocity.x * deltaTime, m_Velocity.y * deltaTime});
+        }
+
+        float decay = expf(-INERTIA_FRICTION * deltaTime);
+        m_Velocity.x *= decay;
+        m_Velocity.y *= decay;
+
+        if (m_Velocity.x * m_Velocity.x + m_Velocity.y * m_Velocity.y < INERTIA_MIN_SPEED * INERTIA_MIN_SPEED) {
+            m_Velocity = {0.f, 0.f};
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <imgui.h>
+
+namespace engine::ui {
+    // turns raw touches into ImGui input. a single finger drives the mouse as before; two fingers scroll through
+    // mouse wheel events and pinch, and a two finger scroll keeps gliding with inertia after release
+    struct ImGui_ImplEngine_TouchState {
+        static constexpr int MAX_TOUCHES = 10;
+
+        void OnTouchDown(ImGuiIO &io, int fingerId, ImVec2 position);
+        void OnTouchMove(ImGuiIO &io, int fingerId, ImVec2 position);
+        void OnTouchUp(ImGuiIO &io, int fingerId, ImVec2 position);
+        // a pointer hovering the screen without touching it
+        void OnHover(ImGuiIO &io, ImVec2 position);
+
+        // once per frame, after the frame's input was applied: tracks scroll velocity and runs inertia
+        void Update(ImGuiIO &io, float deltaTime);
+
+        // true while inertial scrolling still needs frames, even without any input
+        bool IsAnimating() const { return m_Velocity.x != 0.f || m_Velocity.y != 0.f; }
+
+        bool IsGestureActive() const { return m_Gesture; }
+        // pinch scale change over the last frame; 1 when not pinching
+        float GetZoomDelta() const { return m_ZoomDelta; }
+        ImVec2 GetGestureCenter() const { return m_GestureCenter; }
+    protected:
+        struct Touch {
+            int m_Id;
+            ImVec2 m_Position;
+        };
+
+        Touch *FindTouch(int fingerId);
+        void ResetGestureAnchor();
+        void EmitScroll(ImGuiIO &io, ImVec2 delta);
+
+        Touch m_Touches[MAX_TOUCHES];
+        int m_TouchCount = 0;
+
+        // finger emulating the mouse, -1 if none
+        int m_PrimaryId = -1;
+
+        // a second finger went down; the gesture lasts until every finger is lifted, so going back to one finger
+        // never turns into a click
+        bool m_Gesture = false;
+        ImVec2 m_GestureCenter = {0.f, 0.f};
+        float m_GestureSpan = 0.f;
+
+        ImVec2 m_FrameScroll = {0.f, 0.f};
+        float m_FrameZoom = 1.f;
+        float m_ZoomDelta = 1.f;
+
+        // smoothed two finger scroll speed in pixels per second; carries on as inertia once the fingers are lifted
+        ImVec2 m_Velocity = {0.f, 0.f};
+    };
+}
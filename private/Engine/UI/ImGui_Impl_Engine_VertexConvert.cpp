@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Engine/UI/ImGui_Impl_Engine_VertexConvert.hpp>
+
+// the vector kernels convert from the stock ImDrawVert; the engine layout is copied instead
+#if defined(RIFT_IMGUI_ENGINE_VERTEX_LAYOUT)
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RIFT_IMGUI_VTX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define RIFT_IMGUI_VTX_NEON
+#include <arm_neon.h>
+#endif
+
+namespace engine::ui {
+    // the vector kernels write the engine vertex as raw floats: pos.xyz, uv.xy, normal.xyz followed by 4 color bytes
+    static constexpr bool g_VertexLayoutIsPacked = sizeof(core::runtime::graphics::Vertex) == 9 * sizeof(float) &&
+                                                   sizeof(ImDrawVert) == 4 * sizeof(float) + sizeof(ImU32);
+
+    void ImGui_ImplEngine_ConvertVerticesScalar(const ImDrawVert *src, core::runtime::graphics::Vertex *dst,
+                                                size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = ImGui_ImplEngine_ConvertVertex(src[i]);
+        }
+    }
+
+    void ImGui_ImplEngine_TranslateVertices(core::runtime::graphics::Vertex *vertices, size_t count, ImVec2 offset) {
+        for (size_t i = 0; i < count; i++) {
+            // the position leads the engine vertex, see ImGui_ImplEngine_ConvertVertex
+            auto pos = reinterpret_cast<float *>(&vertices[i]);
+            pos[0] += offset.x;
+            pos[1] += offset.y;
+        }
+    }
+
+    void ImGui_ImplEngine_OrientTexturePixels(std::vector<core::runtime::graphics::Color> &pixels,
+                                              int width, int height) {
+#ifdef RIFT_IMGUI_ENGINE_VERTEX_LAYOUT
+        // V reaches the renderer unflipped, so the rows are flipped once here rather than per vertex and frame
+        for (int top = 0, bottom = height - 1; top < bottom; top++, bottom--) {
+            std::swap_ranges(pixels.begin() + (size_t) top * width, pixels.begin() + (size_t) (top + 1) * width,
+                             pixels.begin() + (size_t) bottom * width);
+        }
+#else
+        (void) pixels;
+        (void) width;
+        (void) height;
+#endif
+    }
+
+#if defined(RIFT_IMGUI_ENGINE_VERTEX_LAYOUT)
+    static_assert(sizeof(ImDrawVert) == sizeof(core::runtime::graphics::Vertex),
+                  "ImDrawVert does not match the engine vertex, see ImGui_Rift_Config.hpp!");
+
+    // ImDrawVert already is an engine vertex; only the members ImGui never writes need clearing
+    static void ImGui_ImplEngine_CopyVertices(const ImDrawVert *src, core::runtime::graphics::Vertex *dst,
+                                              size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            ImDrawVert vtx = src[i];
+            vtx.z = 0.f;
+            vtx.normal[0] = vtx.normal[1] = vtx.normal[2] = 0.f;
+            memcpy(&dst[i], &vtx, sizeof(vtx));
+        }
+    }
+#endif
+
+#if defined(RIFT_IMGUI_VTX_SSE2)
+    static void ImGui_ImplEngine_ConvertVerticesSSE2(const ImDrawVert *src, core::runtime::graphics::Vertex *dst,
+                                                     size_t count) {
+        const __m128 one = _mm_set_ss(1.f);
+        const __m128 keepXYW = _mm_castsi128_ps(_mm_set_epi32(-1, 0, -1, -1));
+
+        auto in = reinterpret_cast<const uint8_t *>(src);
+        auto out = reinterpret_cast<uint8_t *>(dst);
+
+        for (size_t i = 0; i < count; i++, in += sizeof(ImDrawVert), out += sizeof(core::runtime::graphics::Vertex)) {
+            // [pos.x, pos.y, uv.x, uv.y]
+            __m128 posUv = _mm_loadu_ps(reinterpret_cast<const float *>(in));
+
+            // [pos.x, pos.y, 0, uv.x]
+            __m128 lo = _mm_and_ps(_mm_shuffle_ps(posUv, posUv, _MM_SHUFFLE(2, 2, 1, 0)), keepXYW);
+            // [1 - uv.y, 0, 0, 0]
+            __m128 hi = _mm_sub_ss(one, _mm_shuffle_ps(posUv, posUv, _MM_SHUFFLE(3, 3, 3, 3)));
+
+            _mm_storeu_ps(reinterpret_cast<float *>(out), lo);
+            _mm_storeu_ps(reinterpret_cast<float *>(out + 16), hi);
+            memcpy(out + 32, in + 16, sizeof(ImU32));
+        }
+    }
+#elif defined(RIFT_IMGUI_VTX_NEON)
+    static void ImGui_ImplEngine_ConvertVerticesNEON(const ImDrawVert *src, core::runtime::graphics::Vertex *dst,
+                                                     size_t count) {
+        const float32x4_t zero = vdupq_n_f32(0.f);
+
+        auto in = reinterpret_cast<const uint8_t *>(src);
+        auto out = reinterpret_cast<uint8_t *>(dst);
+
+        for (size_t i = 0; i < count; i++, in += sizeof(ImDrawVert), out += sizeof(core::runtime::graphics::Vertex)) {
+            // [pos.x, pos.y, uv.x, uv.y]
+            float32x4_t posUv = vld1q_f32(reinterpret_cast<const float *>(in));
+
+            // [pos.x, pos.y, 0, uv.x]
+            float32x4_t lo = vsetq_lane_f32(vgetq_lane_f32(posUv, 2), vsetq_lane_f32(0.f, posUv, 2), 3);
+            // [1 - uv.y, 0, 0, 0]
+            float32x4_t hi = vsetq_lane_f32(1.f - vgetq_lane_f32(posUv, 3), zero, 0);
+
+            vst1q_f32(reinterpret_cast<float *>(out), lo);
+            vst1q_f32(reinterpret_cast<float *>(out + 16), hi);
+            memcpy(out + 32, in + 16, sizeof(ImU32));
+        }
+    }
+#endif
+
+    // runs a candidate kernel over a handful of awkward vertices and compares it byte-by-byte with the scalar path,
+    // which also catches engine builds where Vertex is laid out differently than the kernels expect
+    static bool ImGui_ImplEngine_ValidateConverter(ImGui_ImplEngine_ConvertVerticesFn fn) {
+        struct ProbeVertex {
+            ImVec2 m_Pos;
+            ImVec2 m_Uv;
+            ImU32 m_Col;
+        };
+
+        static const ProbeVertex values[] = {
+                {{0.f,      0.f},     {0.f,       0.f},       IM_COL32(0, 0, 0, 0)},
+                {{-12.5f,   1920.f},  {1.f,       1.f},       IM_COL32(255, 255, 255, 255)},
+                {{3.14159f, -0.f},    {0.33333f,  0.999999f}, IM_COL32(1, 2, 3, 4)},
+                {{1e-30f,   65535.f}, {0.015625f, 0.5f},      IM_COL32(200, 100, 50, 25)},
+                {{7.f,      8.f},     {-0.25f,    1.75f},     IM_COL32(17, 34, 51, 68)},
+        };
+        constexpr size_t count = sizeof(values) / sizeof(values[0]);
+
+        // whatever an ImDrawVert holds besides these is garbage, as it is in ImGui's buffers
+        ImDrawVert probe[count];
+        memset((void *) probe, 0xCD, sizeof(probe));
+
+        for (size_t i = 0; i < count; i++) {
+            probe[i].pos = values[i].m_Pos;
+            probe[i].uv = values[i].m_Uv;
+            probe[i].col = values[i].m_Col;
+        }
+
+        core::runtime::graphics::Vertex expected[count];
+        core::runtime::graphics::Vertex actual[count];
+        memset(expected, 0, sizeof(expected));
+        memset(actual, 0xCD, sizeof(actual));
+
+        ImGui_ImplEngine_ConvertVerticesScalar(probe, expected, count);
+        fn(probe, actual, count);
+
+        return memcmp(expected, actual, sizeof(expected)) == 0;
+    }
+
+    struct ImGui_ImplEngine_VertexConverter {
+        ImGui_ImplEngine_ConvertVerticesFn m_Convert;
+        const char *m_Name;
+    };
+
+    static ImGui_ImplEngine_VertexConverter ImGui_ImplEngine_SelectVertexConverter() {
+#if defined(RIFT_IMGUI_ENGINE_VERTEX_LAYOUT)
+        if (ImGui_ImplEngine_ValidateConverter(ImGui_ImplEngine_CopyVertices)) {
+            return {ImGui_ImplEngine_CopyVertices, "copy"};
+        }
+#endif
+
+        if constexpr (g_VertexLayoutIsPacked) {
+#if defined(RIFT_IMGUI_VTX_SSE2)
+            if (ImGui_ImplEngine_ValidateConverter(ImGui_ImplEngine_ConvertVerticesSSE2)) {
+                return {ImGui_ImplEngine_ConvertVerticesSSE2, "sse2"};
+            }
+#elif defined(RIFT_IMGUI_VTX_NEON)
+            if (ImGui_ImplEngine_ValidateConverter(ImGui_ImplEngine_ConvertVerticesNEON)) {
+                return {ImGui_ImplEngine_ConvertVerticesNEON, "neon"};
+            }
+#endif
+        }
+
+        return {ImGui_ImplEngine_ConvertVerticesScalar, "scalar"};
+    }
+
+    static const ImGui_ImplEngine_VertexConverter &ImGui_ImplEngine_GetSelectedConverter() {
+        static const ImGui_ImplEngine_VertexConverter converter = ImGui_ImplEngine_SelectVertexConverter();
+        return converter;
+    }
+
+    ImGui_ImplEngine_ConvertVerticesFn ImGui_ImplEngine_GetVertexConverter() {
+        return ImGui_ImplEngine_GetSelectedConverter().m_Convert;
+    }
+
+    const char *ImGui_ImplEngine_GetVertexConverterName() {
+        return ImGui_ImplEngine_GetSelectedConverter().m_Name;
+    }
+}
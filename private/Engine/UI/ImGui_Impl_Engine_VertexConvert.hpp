@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Engine/Core/Runtime/Graphics/Vertex.hpp>
+#include <Engine/UI/ImGui.hpp>
+
+namespace engine::ui {
+    using ImGui_ImplEngine_ConvertVerticesFn = void (*)(const ImDrawVert *src,
+                                                        core::runtime::graphics::Vertex *dst,
+                                                        size_t count);
+
+    // reference conversion; position widened to 3D, V flipped, normal zeroed and the packed color split into bytes.
+    // with RIFT_IMGUI_ENGINE_VERTEX_LAYOUT the textures are flipped instead of V
+    static inline core::runtime::graphics::Vertex ImGui_ImplEngine_ConvertVertex(const ImDrawVert &vtx) {
+        return {
+                {vtx.pos.x, vtx.pos.y, 0.f},
+#ifdef RIFT_IMGUI_ENGINE_VERTEX_LAYOUT
+                {vtx.uv.x,  vtx.uv.y},
+#else
+                {vtx.uv.x,  1.f - vtx.uv.y},
+#endif
+                {0.f,       0.f,       0.f},
+                {
+                        (uint8_t) (vtx.col & 0xFF),
+                        (uint8_t) ((vtx.col >> 8) & 0xFF),
+                        (uint8_t) ((vtx.col >> 16) & 0xFF),
+                        (uint8_t) ((vtx.col >> 24) & 0xFF),
+                }
+        };
+    }
+
+    extern void ImGui_ImplEngine_ConvertVerticesScalar(const ImDrawVert *src,
+                                                       core::runtime::graphics::Vertex *dst,
+                                                       size_t count);
+
+    // moves converted vertices by offset, e.g. from screen space into the space of the window they are drawn in
+    extern void ImGui_ImplEngine_TranslateVertices(core::runtime::graphics::Vertex *vertices, size_t count,
+                                                   ImVec2 offset);
+
+    // brings the pixels of a texture about to be uploaded into the orientation the vertices expect
+    extern void ImGui_ImplEngine_OrientTexturePixels(std::vector<core::runtime::graphics::Color> &pixels,
+                                                     int width, int height);
+
+    // returns the fastest kernel usable on this CPU and vertex layout; picked once and validated against the scalar path
+    extern ImGui_ImplEngine_ConvertVerticesFn ImGui_ImplEngine_GetVertexConverter();
+
+    extern const char *ImGui_ImplEngine_GetVertexConverterName();
+}
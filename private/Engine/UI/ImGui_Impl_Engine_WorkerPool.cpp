@@ -0,0 +1,82 @@
+#include <Engine/UI/ImGui_Impl_Engine_WorkerPool.hpp>
+
+namespace engine::ui {
+    ImGui_ImplEngine_WorkerPool::ImGui_ImplEngine_WorkerPool(int threadCount) {
+        for (int i = 0; i < threadCount; i++) {
+            m_Threads.emplace_back(&ImGui_ImplEngine_WorkerPool::WorkerMain, this);
+        }
+    }
+
+    ImGui_ImplEngine_WorkerPool::~ImGui_ImplEngine_WorkerPool() {
+        {
+            std::lock_guard lock(m_Lock);
+            m_Quit = true;
+        }
+
+        m_WakeCondition.notify_all();
+
+        for (auto &thread: m_Threads) {
+            thread.join();
+        }
+    }
+
+    void ImGui_ImplEngine_WorkerPool::RunTasks() {
+        for (int index; (index = m_NextIndex.fetch_add(1, std::memory_order_relaxed)) < m_Count;) {
+            m_Fn(m_UserData, index);
+        }
+    }
+
+    void ImGui_ImplEngine_WorkerPool::WorkerMain() {
+        uint64_t generation = 0;
+
+        for (;;) {
+            {
+                std::unique_lock lock(m_Lock);
+                m_WakeCondition.wait(lock, [&]() { return m_Quit || m_Generation != generation; });
+
+                if (m_Quit) {
+                    return;
+                }
+
+                generation = m_Generation;
+            }
+
+            RunTasks();
+
+            std::lock_guard lock(m_Lock);
+
+            if (--m_BusyWorkers == 0) {
+                m_DoneCondition.notify_one();
+            }
+        }
+    }
+
+    void ImGui_ImplEngine_WorkerPool::ParallelFor(int count, TaskFn fn, void *userData) {
+        std::unique_lock caller(m_CallerLock, std::try_to_lock);
+
+        if (!caller.owns_lock() || m_Threads.empty() || count < 2) {
+            for (int i = 0; i < count; i++) {
+                fn(userData, i);
+            }
+
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_Lock);
+            m_Fn = fn;
+            m_UserData = userData;
+            m_Count = count;
+            m_NextIndex.store(0, std::memory_order_relaxed);
+            m_BusyWorkers = (int) m_Threads.size();
+            m_Generation++;
+        }
+
+        m_WakeCondition.notify_all();
+        RunTasks();
+
+        // every worker checks in, even those that found no index left, so the next loop starts from a clean slate
+        std::unique_lock lock(m_Lock);
+        m_DoneCondition.wait(lock, [&]() { return m_BusyWorkers == 0; });
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::ui {
+    // small fixed set of threads for the data-parallel loops of the backend. indices are handed out one at a time,
+    // so uneven work (one huge draw list among small ones) still spreads; the calling thread takes part as well
+    struct ImGui_ImplEngine_WorkerPool {
+        using TaskFn = void (*)(void *userData, int index);
+
+        explicit ImGui_ImplEngine_WorkerPool(int threadCount);
+        ~ImGui_ImplEngine_WorkerPool();
+
+        ImGui_ImplEngine_WorkerPool(const ImGui_ImplEngine_WorkerPool &) = delete;
+        ImGui_ImplEngine_WorkerPool &operator=(const ImGui_ImplEngine_WorkerPool &) = delete;
+
+        // runs fn for every index in [0, count) and returns once all of them finished. while another thread is
+        // using the pool, the loop runs on the calling thread alone instead of waiting for it
+        void ParallelFor(int count, TaskFn fn, void *userData);
+
+        int GetThreadCount() const { return (int) m_Threads.size(); }
+    protected:
+        void WorkerMain();
+        void RunTasks();
+
+        std::vector<std::thread> m_Threads;
+        // held for the duration of a ParallelFor; one loop at a time
+        std::mutex m_CallerLock;
+
+        std::mutex m_Lock;
+        std::condition_variable m_WakeCondition;
+        std::condition_variable m_DoneCondition;
+        uint64_t m_Generation = 0;
+        int m_BusyWorkers = 0;
+        bool m_Quit = false;
+
+        TaskFn m_Fn = nullptr;
+        void *m_UserData = nullptr;
+        int m_Count = 0;
+        std::atomic<int> m_NextIndex = 0;
+    };
+}
@@ -0,0 +1,77 @@
+#include <Engine/UI/ImGui_MappedFile.hpp>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine::ui {
+    bool ImGui_MappedFile::Open(const char *path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        m_File = (intptr_t) file;
+
+        LARGE_INTEGER size;
+
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (!mapping) {
+            return false;
+        }
+
+        m_Mapping = (intptr_t) mapping;
+        m_Data = (const uint8_t *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        m_Size = (size_t) size.QuadPart;
+#else
+        int fd = open(path, O_RDONLY);
+
+        if (fd < 0) {
+            return false;
+        }
+
+        m_File = fd;
+
+        struct stat st{};
+
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            return false;
+        }
+
+        void *data = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED) {
+            return false;
+        }
+
+        m_Data = (const uint8_t *) data;
+        m_Size = (size_t) st.st_size;
+#endif
+        return m_Data != nullptr;
+    }
+
+    ImGui_MappedFile::~ImGui_MappedFile() {
+#if defined(_WIN32)
+        if (m_Data) { UnmapViewOfFile(m_Data); }
+        if (m_Mapping) { CloseHandle((HANDLE) m_Mapping); }
+        if (m_File != -1) { CloseHandle((HANDLE) m_File); }
+#else
+        if (m_Data) { munmap((void *) m_Data, m_Size); }
+        if (m_File >= 0) { close((int) m_File); }
+#endif
+    }
+}
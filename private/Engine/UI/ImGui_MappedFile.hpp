@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::ui {
+    // read-only view of a whole file, memory mapped where the platform allows it
+    struct ImGui_MappedFile {
+        ImGui_MappedFile() = default;
+        ImGui_MappedFile(const ImGui_MappedFile &) = delete;
+        ImGui_MappedFile &operator=(const ImGui_MappedFile &) = delete;
+        ~ImGui_MappedFile();
+
+        bool Open(const char *path);
+
+        const uint8_t *GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+    protected:
+        const uint8_t *m_Data = nullptr;
+        size_t m_Size = 0;
+
+        // platform handles: file descriptor on POSIX, file and mapping HANDLEs on Windows
+        intptr_t m_File = -1;
+        intptr_t m_Mapping = 0;
+    };
+}
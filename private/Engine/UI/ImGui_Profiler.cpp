@@ -0,0 +1,136 @@
+#include <cstdio>
+#include <cstring>
+
+#include <Engine/UI/ImGui_Profiler.hpp>
+
+namespace engine::ui {
+    void ImGui_ProfilerHistory::Record(const ImGui_ProfilerFrame &frame) {
+        uint64_t frameIndex = m_FramesWritten.load(std::memory_order_relaxed);
+        auto &slot = m_Slots[frameIndex % PROFILER_HISTORY];
+
+        uint32_t sequence = slot.m_Sequence.load(std::memory_order_relaxed);
+        slot.m_Sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(&slot.m_Frame, &frame, sizeof(frame));
+        slot.m_Frame.FrameIndex = frameIndex;
+
+        slot.m_Sequence.store(sequence + 2, std::memory_order_release);
+        m_FramesWritten.store(frameIndex + 1, std::memory_order_release);
+    }
+
+    bool ImGui_ProfilerHistory::Read(int framesAgo, ImGui_ProfilerFrame &frame) const {
+        for (;;) {
+            uint64_t written = m_FramesWritten.load(std::memory_order_acquire);
+
+            if (framesAgo < 0 || framesAgo >= PROFILER_HISTORY || (uint64_t) framesAgo >= written) {
+                return false;
+            }
+
+            uint64_t frameIndex = written - 1 - framesAgo;
+            auto &slot = m_Slots[frameIndex % PROFILER_HISTORY];
+
+            uint32_t before = slot.m_Sequence.load(std::memory_order_acquire);
+
+            if (before & 1) {
+                continue;
+            }
+
+            memcpy(&frame, &slot.m_Frame, sizeof(frame));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // the slot might have been recycled for a newer frame meanwhile
+            if (slot.m_Sequence.load(std::memory_order_relaxed) == before && frame.FrameIndex == frameIndex) {
+                return true;
+            }
+        }
+    }
+
+    void ImGui_ProfilerHistory::DrawOverlay() {
+        auto &frame = m_OverlayFrame;
+        auto &totals = m_OverlayTotals;
+
+        float newFrame = 0.f, widgets = 0.f, render = 0.f, renderDrawData = 0.f;
+        int count = 0;
+
+        for (; count < PROFILER_OVERLAY_AVERAGE && Read(count, frame); count++) {
+            newFrame += frame.NewFrameMs;
+            widgets += frame.WidgetsMs;
+            render += frame.RenderMs;
+            renderDrawData += frame.RenderDrawDataMs;
+
+            // oldest first for the plot
+            totals[PROFILER_OVERLAY_AVERAGE - 1 - count] =
+                    frame.NewFrameMs + frame.WidgetsMs + frame.RenderMs + frame.RenderDrawDataMs;
+        }
+
+        ImGui::SetNextWindowBgAlpha(0.85f);
+
+        if (!ImGui::Begin("Rift UI Profiler", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings |
+                                                       ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav)) {
+            ImGui::End();
+            return;
+        }
+
+        if (count == 0) {
+            ImGui::TextUnformatted("No frames recorded yet.");
+            ImGui::End();
+            return;
+        }
+
+        float scale = 1.f / (float) count;
+        ImGui::Text("Average over %d frames", count);
+        ImGui::Text("NewFrame        %.3f ms", newFrame * scale);
+        ImGui::Text("Widgets         %.3f ms", widgets * scale);
+        ImGui::Text("Render          %.3f ms", render * scale);
+        ImGui::Text("RenderDrawData  %.3f ms", renderDrawData * scale);
+
+        ImGui::PlotLines("##total", totals + (PROFILER_OVERLAY_AVERAGE - count), count, 0, "total ms", 0.f,
+                         3.4e38f, ImVec2(0.f, 40.f));
+
+        ImGui::Separator();
+
+        if (Read(0, frame)) {
+            ImGui::Text("Last frame: %u vtx, %u idx, %u cmds, %u SubmitUI",
+                        frame.VertexCount, frame.IndexCount, frame.CommandCount, frame.SubmitCount);
+            ImGui::Text("ImGui heap: %u allocs, %.1f KB allocated, %.1f KB in use", frame.AllocationCount,
+                        (double) frame.AllocatedBytes / 1024.0, (double) frame.BytesInUse / 1024.0);
+
+            uint32_t shown = frame.WindowCount < ImGui_ProfilerFrame::MAX_WINDOWS
+                             ? frame.WindowCount : ImGui_ProfilerFrame::MAX_WINDOWS;
+
+            if (ImGui::BeginTable("##windows", 5)) {
+                ImGui::TableSetupColumn("Window");
+                ImGui::TableSetupColumn("Vtx");
+                ImGui::TableSetupColumn("Idx");
+                ImGui::TableSetupColumn("Cmds");
+                ImGui::TableSetupColumn("Submits");
+                ImGui::TableHeadersRow();
+
+                for (uint32_t i = 0; i < shown; i++) {
+                    const auto &window = frame.Windows[i];
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(window.Name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", window.VertexCount);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", window.IndexCount);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", window.CommandCount);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", window.SubmitCount);
+                }
+
+                ImGui::EndTable();
+            }
+
+            if (frame.WindowCount > shown) {
+                ImGui::Text("... and %u more", frame.WindowCount - shown);
+            }
+        }
+
+        ImGui::End();
+    }
+}
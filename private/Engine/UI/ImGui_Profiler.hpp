@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+
+#include <Engine/UI/ImGui.hpp>
+
+namespace engine::ui {
+    static constexpr int PROFILER_HISTORY = 120;
+    static constexpr int PROFILER_OVERLAY_AVERAGE = 60;
+
+    // single producer ring; every slot is guarded by a sequence counter that is odd while the slot is being written,
+    // so readers never block the UI thread and simply retry when they raced with a write
+    struct ImGui_ProfilerSlot {
+        std::atomic<uint32_t> m_Sequence{0};
+        ImGui_ProfilerFrame m_Frame;
+    };
+
+    // the recorded frames of one context, written by the thread building its UI
+    struct ImGui_ProfilerHistory {
+        // publishes a finished frame; must only be called from the thread building the context's UI
+        void Record(const ImGui_ProfilerFrame &frame);
+
+        // safe to call from any thread while frames keep being recorded
+        bool Read(int framesAgo, ImGui_ProfilerFrame &frame) const;
+
+        // built-in overlay window showing the recorded history; has to run between ImGui::NewFrame and
+        // ImGui::Render of the owning context
+        void DrawOverlay();
+    protected:
+        ImGui_ProfilerSlot m_Slots[PROFILER_HISTORY];
+        std::atomic<uint64_t> m_FramesWritten{0};
+
+        // overlay scratch, UI thread only
+        ImGui_ProfilerFrame m_OverlayFrame;
+        float m_OverlayTotals[PROFILER_OVERLAY_AVERAGE] = {};
+    };
+}
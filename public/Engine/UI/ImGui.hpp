@@ -1,16 +1,338 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include <imgui.h>
 
+#include <Engine/Core/Runtime/Graphics/Color.hpp>
 #include <Engine/Core/Runtime/Graphics/IGraphicsContext.hpp>
 #include <Engine/Core/Runtime/Graphics/IRenderer.hpp>
+#include <Engine/Core/Runtime/IWindow.hpp>
 
 namespace engine::ui {
+    // optional behaviour of the Rift ImGui backend; everything is off by default
+    typedef uint32_t ImGui_RiftFlags;
+
+    enum ImGui_RiftFlags_ : uint32_t {
+        ImGui_RiftFlags_None = 0,
+        // coalesce adjacent draw commands sharing a texture and scissor into a single UIRenderItem
+        ImGui_RiftFlags_MergeCommands = 1 << 0,
+        // reuse the converted items of draw lists whose content did not change since the previous frame. what is
+        // saved is the conversion: every list is still hashed in full each frame (one pass over its vertices and
+        // indices), and reused items are copied into their UIRenderItem since the renderer takes ownership of it.
+        // lists that keep changing are handed over without being kept
+        ImGui_RiftFlags_RetainedSubmission = 1 << 1,
+        // stop rebuilding the UI while there is no input, animation or dirty hint and present the last frame again
+        ImGui_RiftFlags_IdleThrottling = 1 << 2,
+        // record per-stage and per-window costs of every frame, see ImGui_GetProfilerFrame
+        ImGui_RiftFlags_Profiler = 1 << 3,
+        // show the built-in profiler window; implies ImGui_RiftFlags_Profiler
+        ImGui_RiftFlags_ProfilerOverlay = 1 << 4,
+        // keep ImGui's CPU-side font atlas pixels after the font texture was uploaded
+        ImGui_RiftFlags_KeepFontAtlasPixels = 1 << 5,
+        // convert the draw lists of large frames on several threads; submission order and merging are unchanged
+        ImGui_RiftFlags_ParallelConversion = 1 << 6,
+        // don't show ImGui's demo window, which the default context otherwise shows in every frame it builds
+        ImGui_RiftFlags_HideDemoWindow = 1 << 7,
+    };
+
+    struct ImGui_RenderStats {
+        // largest amount of converted vertices / indices the frame arena had to hold at once
+        size_t ArenaVertexHighWater = 0;
+        size_t ArenaIndexHighWater = 0;
+        // memory currently reserved by the arena
+        size_t ArenaCapacityBytes = 0;
+        // arena reallocations since init and during the last rendered frame; the latter is 0 in steady state. the
+        // arena is only the staging side, see SubmitAllocationCount for what submission allocates
+        uint32_t ArenaGrowCount = 0;
+        uint32_t ArenaFrameGrowCount = 0;
+
+        // draw commands of the last frame, the UIRenderItems they became and how many were folded into a previous one
+        uint32_t CommandCount = 0;
+        uint32_t SubmittedCommandCount = 0;
+        uint32_t MergedCommandCount = 0;
+        // vertices handed to the renderer in the last frame, after de-indexing
+        uint32_t SubmittedVertexCount = 0;
+        // vertex buffers allocated for the UIRenderItems of the last frame and their size. IRenderer::SubmitUI takes
+        // ownership of every item's vertices, so this is one allocation per submitted item even in steady state;
+        // merging commands is what brings it down
+        uint32_t SubmitAllocationCount = 0;
+        size_t SubmitAllocatedBytes = 0;
+
+        // draw lists reused unchanged / converted again in the last frame when retained submission is enabled
+        uint32_t RetainedListCount = 0;
+        uint32_t RebuiltListCount = 0;
+
+        // threads that converted the draw lists of the last frame, the calling one included
+        uint32_t ConversionThreadCount = 0;
+
+        // images registered through ImGui_CreateTexture, the bytes of those currently uploaded, uploads done while
+        // building the last frame and evictions since init
+        uint32_t TextureCount = 0;
+        size_t TextureResidentBytes = 0;
+        uint32_t TextureUploadCount = 0;
+        uint32_t TextureEvictionCount = 0;
+
+        // input events applied in the last frame, moves among them folded into a later one, and events rejected
+        // since init because the input queue was full
+        uint32_t InputEventCount = 0;
+        uint32_t CoalescedInputEventCount = 0;
+        uint32_t DroppedInputEventCount = 0;
+
+        // frames since init that re-presented the previous frame instead of building a new one
+        uint32_t IdleFrameCount = 0;
+
+        // frames written by the running or last capture, and the ones skipped because the disk fell behind
+        uint32_t CapturedFrameCount = 0;
+        uint32_t CaptureDroppedFrameCount = 0;
+    };
+
+    // ImGui's heap use through the pool allocator, see ImGui_SetPoolAllocatorEnabled. process-wide: the allocator is
+    // shared by all contexts and cannot tell them apart, so with several of them a frame counts whatever any
+    // context allocated meanwhile
+    struct ImGui_AllocatorStats {
+        // allocations, frees and requested bytes between the ends of the last two frames finished by any context
+        uint32_t FrameAllocationCount = 0;
+        uint32_t FrameFreeCount = 0;
+        size_t FrameAllocatedBytes = 0;
+
+        // requested bytes currently allocated and the most there ever were at once
+        size_t BytesInUse = 0;
+        size_t PeakBytesInUse = 0;
+        // memory taken from the system heap, pool slabs are kept for reuse and never given back
+        size_t ReservedBytes = 0;
+
+        // since the allocator was installed; large ones exceed the biggest size class and go to malloc directly
+        uint64_t TotalAllocationCount = 0;
+        uint64_t LargeAllocationCount = 0;
+    };
+
+    // two finger touch gesture of the last frame. scrolling is applied through mouse wheel events already; pinch
+    // is left to widgets that zoom, e.g. scale a plot by ZoomDelta around Center
+    struct ImGui_TouchGesture {
+        bool Active = false;
+        // scale change since the previous frame, 1 when not pinching
+        float ZoomDelta = 1.f;
+        ImVec2 Center = {0.f, 0.f};
+    };
+
+    // CPU cost of one engine frame spent in the UI layer
+    struct ImGui_FrameTiming {
+        // delta time handed to ImGui; 0 for idle frames
+        float DeltaTime = 0.f;
+        float BeginFrameMs = 0.f;
+        // includes RenderDrawDataMs
+        float EndFrameMs = 0.f;
+        float RenderDrawDataMs = 0.f;
+        bool Idle = false;
+    };
+
+    struct ImGui_ProfilerWindow {
+        // window owning the draw list, truncated
+        char Name[40] = {};
+        uint32_t VertexCount = 0;
+        uint32_t IndexCount = 0;
+        uint32_t CommandCount = 0;
+        uint32_t SubmitCount = 0;
+    };
+
+    struct ImGui_ProfilerFrame {
+        static constexpr uint32_t MAX_WINDOWS = 32;
+
+        uint64_t FrameIndex = 0;
+        bool Idle = false;
+
+        float NewFrameMs = 0.f;
+        // user widget code between ImGui_BeginFrame and ImGui_EndFrame
+        float WidgetsMs = 0.f;
+        float RenderMs = 0.f;
+        float RenderDrawDataMs = 0.f;
+
+        // totals over all draw lists
+        uint32_t VertexCount = 0;
+        uint32_t IndexCount = 0;
+        uint32_t CommandCount = 0;
+        uint32_t SubmitCount = 0;
+
+        // ImGui heap activity of the frame, process-wide like ImGui_AllocatorStats
+        uint32_t AllocationCount = 0;
+        size_t AllocatedBytes = 0;
+        size_t BytesInUse = 0;
+
+        // every draw list of the frame is counted, only the first MAX_WINDOWS are stored
+        uint32_t WindowCount = 0;
+        ImGui_ProfilerWindow Windows[MAX_WINDOWS];
+    };
+
+    // returns the current time in seconds; lets ImGui follow the engine's frame clock instead of its own
+    using ImGui_FrameClockFn = double (*)();
+
+    // how the application opens the OS windows that ImGui viewports are torn out into. windows and graphics contexts
+    // are created by the engine outside of this module, so the backend asks for them through these; only OpenWindow
+    // is required, the others do nothing when left null. positions are in screen space
+    struct ImGui_ViewportWindowHooks {
+        // opens a window and returns its graphics context and renderer; false if no window could be created
+        bool (*OpenWindow)(ImVec2 pos, ImVec2 size, ImGuiViewportFlags flags,
+                             core::runtime::graphics::IGraphicsContext **gContext,
+                             core::runtime::graphics::IRenderer **renderer, void *userData) = nullptr;
+        void (*CloseWindow)(core::runtime::graphics::IGraphicsContext *gContext,
+                              core::runtime::graphics::IRenderer *renderer, void *userData) = nullptr;
+
+        void (*ShowWindow)(core::runtime::IWindow *window, void *userData) = nullptr;
+        ImVec2 (*GetWindowPos)(core::runtime::IWindow *window, void *userData) = nullptr;
+        void (*SetWindowPos)(core::runtime::IWindow *window, ImVec2 pos, void *userData) = nullptr;
+        void (*SetWindowSize)(core::runtime::IWindow *window, ImVec2 size, void *userData) = nullptr;
+        void (*SetWindowTitle)(core::runtime::IWindow *window, const char *title, void *userData) = nullptr;
+        void (*SetWindowFocus)(core::runtime::IWindow *window, void *userData) = nullptr;
+        bool (*GetWindowFocus)(core::runtime::IWindow *window, void *userData) = nullptr;
+        bool (*GetWindowMinimized)(core::runtime::IWindow *window, void *userData) = nullptr;
+
+        // presents what the backend submitted to the window's renderer this frame
+        void (*PresentWindow)(core::runtime::graphics::IGraphicsContext *gContext, void *userData) = nullptr;
+
+        // fills up to maxCount monitors and returns how many there are; without it the main window is the only one
+        int (*GetMonitors)(ImGuiPlatformMonitor *monitors, int maxCount, void *userData) = nullptr;
+
+        void *UserData = nullptr;
+    };
+
+    // the UI of one engine window: its own ImGui context, backend, input queue and frame state
+    struct ImGui_RiftContext;
+    using ImGui_ContextHandle = ImGui_RiftContext *;
+
+    // gContext and renderer may be null for a headless UI that builds frames without presenting them.
+    // creates the default context, which every function taking no handle works on
     extern void ImGui_Initialize(core::runtime::graphics::IGraphicsContext *gContext, core::runtime::graphics::IRenderer* renderer);
     extern void ImGui_Shutdown();
 
-    extern void ImGui_BeginFrame();
+    // creates the UI of another window. with shareFontsWith, the new context draws from that context's font atlas
+    // and texture instead of building its own, and has to be destroyed before it. windows sharing fonts are expected
+    // to share a graphics backend
+    extern ImGui_ContextHandle ImGui_CreateContext(core::runtime::graphics::IGraphicsContext *gContext,
+                                                   core::runtime::graphics::IRenderer *renderer,
+                                                   ImGui_ContextHandle shareFontsWith = nullptr);
+    extern void ImGui_DestroyContext(ImGui_ContextHandle context);
+    extern ImGui_ContextHandle ImGui_GetDefaultContext();
+    extern ImGuiContext *ImGui_GetImGuiContext(ImGui_ContextHandle context);
+    // engine input goes to one context at a time; the first one created until this is called. destroying the
+    // focused context hands input to the oldest one left
+    extern void ImGui_SetInputFocus(ImGui_ContextHandle context);
+
+    // lets windows be dragged out of the main window into windows of their own (the docking branch's viewports).
+    // call outside of a frame; returns false for headless contexts. all viewports share the context's font texture
+    extern bool ImGui_EnableViewports(const ImGui_ViewportWindowHooks &hooks);
+    extern bool ImGui_EnableViewports(ImGui_ContextHandle context, const ImGui_ViewportWindowHooks &hooks);
+
+    // directory the engine asset bundle is unpacked to, "DataRaw/" by default; the string must outlive its use
+    extern void ImGui_SetAssetRoot(const char* root);
+
+    // loads a font from the asset bundle (e.g. "Engine/Fonts/Lexend.ttf") by memory mapping it, without copies
+    extern ImFont* ImGui_AddFont(const char* bundlePath, float sizePixels, const ImFontConfig* config = nullptr);
+    // adds a font the application already holds in memory; the data is not copied and must stay valid until
+    // ImGui_Shutdown
+    extern ImFont* ImGui_AddFontFromMemory(const void* data, size_t size, float sizePixels, const ImFontConfig* config = nullptr);
+    extern ImFont* ImGui_AddFont(ImGui_ContextHandle context, const char* bundlePath, float sizePixels,
+                                 const ImFontConfig* config = nullptr);
+    extern ImFont* ImGui_AddFontFromMemory(ImGui_ContextHandle context, const void* data, size_t size, float sizePixels,
+                                           const ImFontConfig* config = nullptr);
+
+    // file the built font atlas is cached in between runs, Rift/imgui_atlas.cache in the user cache directory by
+    // default; nullptr disables caching. has to be set before ImGui_Initialize and the string must outlive it
+    extern void ImGui_SetFontAtlasCachePath(const char* path);
+
+    // returns false when idle throttling decided to present the previous frame again; no widgets may be
+    // submitted until the matching ImGui_EndFrame in that case
+    extern bool ImGui_BeginFrame();
     extern void ImGui_EndFrame();
+    // contexts are independent: each may build its frames on its own thread, the current ImGui context is per thread
+    extern bool ImGui_BeginFrame(ImGui_ContextHandle context);
+    extern void ImGui_EndFrame(ImGui_ContextHandle context);
+
+    // forces the next frame to be built when idle throttling is enabled, e.g. after application data changed
+    extern void ImGui_MarkDirty();
+    extern void ImGui_MarkDirty(ImGui_ContextHandle context);
+    // longest time the UI may stay idle before a frame is built anyway
+    extern void ImGui_SetMaxIdleInterval(float seconds);
+    extern void ImGui_SetMaxIdleInterval(ImGui_ContextHandle context, float seconds);
 
     extern ImGuiContext* ImGui_GetGlobalContext();
+
+    extern ImGui_RenderStats ImGui_GetRenderStats();
+    extern ImGui_RenderStats ImGui_GetRenderStats(ImGui_ContextHandle context);
+
+    // copies up to maxCount of the most recent frame timings, oldest first, and returns how many were written
+    extern int ImGui_GetFrameTimings(ImGui_FrameTiming *timings, int maxCount);
+    extern int ImGui_GetFrameTimings(ImGui_ContextHandle context, ImGui_FrameTiming *timings, int maxCount);
+    // makes sure the glyphs used by an UTF-8 string are in the font atlas. fonts are built with the default
+    // (Latin) ranges only; missing glyphs are added by rebuilding the whole atlas and re-uploading its texture
+    // before the next frame, so request the text of a screen up front rather than glyph by glyph. typed characters
+    // are requested automatically, each new one costing such a rebuild
+    extern void ImGui_RequestGlyphs(const char *text);
+    extern void ImGui_RequestGlyphs(ImGui_ContextHandle context, const char *text);
+
+    // an image for ImGui::Image, owned by the context that created it and kept alive by references
+    struct ImGui_RiftTexture;
+    using ImGui_TextureHandle = ImGui_RiftTexture *;
+
+    // registers an image holding one reference; without pixels it starts out transparent. nothing is uploaded
+    // until the image is first drawn
+    extern ImGui_TextureHandle ImGui_CreateTexture(int width, int height,
+                                                   const core::runtime::graphics::Color *pixels = nullptr);
+    extern ImGui_TextureHandle ImGui_CreateTexture(ImGui_ContextHandle context, int width, int height,
+                                                   const core::runtime::graphics::Color *pixels = nullptr);
+    // references and updates may come from any thread. an image is freed a few frames after its last reference
+    // is dropped, once no frame in flight can still draw it
+    extern void ImGui_AddTextureRef(ImGui_TextureHandle texture);
+    extern void ImGui_ReleaseTexture(ImGui_TextureHandle texture);
+    // copies a rect of pixels (stride in pixels, 0 if tightly packed); applied at the start of the next frame, and
+    // uploaded once however many updates arrived in between
+    extern bool ImGui_UpdateTexture(ImGui_TextureHandle texture, int x, int y, int width, int height,
+                                    const core::runtime::graphics::Color *pixels, int stride = 0);
+    // the id to draw the image with in the frame being built, e.g. ImGui::Image(ImGui_GetTextureID(texture), size)
+    extern ImTextureID ImGui_GetTextureID(ImGui_TextureHandle texture);
+    // bytes of uploaded images above which the least recently drawn ones are evicted (and uploaded again when
+    // drawn); 0, the default, means no limit
+    extern void ImGui_SetTextureBudget(size_t bytes);
+    extern void ImGui_SetTextureBudget(ImGui_ContextHandle context, size_t bytes);
+
+    extern ImGui_AllocatorStats ImGui_GetAllocatorStats();
+    // ImGui's allocations go through a size-class pool by default, off the contended system heap. only takes effect
+    // before the first context is created; disabling it leaves whatever ImGui::SetAllocatorFunctions set in place
+    extern void ImGui_SetPoolAllocatorEnabled(bool enabled);
+
+    // streams the draw data of every frame of the main viewport and all engine input events to a file, for
+    // Rift_UI_ImGui_replay to time the backend with offline. the file is only complete after ImGui_StopCapture
+    extern bool ImGui_StartCapture(const char *path);
+    extern bool ImGui_StartCapture(ImGui_ContextHandle context, const char *path);
+    extern void ImGui_StopCapture();
+    extern void ImGui_StopCapture(ImGui_ContextHandle context);
+
+    extern ImGui_TouchGesture ImGui_GetTouchGesture();
+    extern ImGui_TouchGesture ImGui_GetTouchGesture(ImGui_ContextHandle context);
+
+    // reads a recorded profiler frame of the context, 0 being the most recent one; lock-free and callable from any
+    // thread while the context lives
+    extern bool ImGui_GetProfilerFrame(int framesAgo, ImGui_ProfilerFrame &frame);
+    extern bool ImGui_GetProfilerFrame(ImGui_ContextHandle context, int framesAgo, ImGui_ProfilerFrame &frame);
+    // nullptr restores the built-in monotonic clock
+    extern void ImGui_SetFrameClock(ImGui_FrameClockFn clock);
+    extern void ImGui_SetFrameClock(ImGui_ContextHandle context, ImGui_FrameClockFn clock);
+
+    // routes an engine key (by its input name, e.g. "Key_Q" or "Mouse_Left") to a different ImGui key or mouse
+    // button; ImGuiKey_None unbinds it. remaps apply to every context until ImGui_ResetKeyMappings and may be made
+    // from any thread, also while other contexts are building frames
+    extern void ImGui_RemapKey(const char *engineKey, ImGuiKey key);
+    extern void ImGui_RemapMouseButton(const char *engineKey, ImGuiMouseButton button);
+    extern void ImGui_ResetKeyMappings();
+
+    extern void ImGui_SetFlags(ImGui_RiftFlags flags);
+    extern ImGui_RiftFlags ImGui_GetFlags();
+    extern void ImGui_SetFlags(ImGui_ContextHandle context, ImGui_RiftFlags flags);
+    extern ImGui_RiftFlags ImGui_GetFlags(ImGui_ContextHandle context);
+
+    // frames with fewer vertices than this are converted on the calling thread even with
+    // ImGui_RiftFlags_ParallelConversion set
+    extern void ImGui_SetParallelConversionThreshold(uint32_t vertexCount);
+    extern void ImGui_SetParallelConversionThreshold(ImGui_ContextHandle context, uint32_t vertexCount);
 }
\ No newline at end of file
@@ -1,3 +1,23 @@
 #pragma once
 
-#define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS
\ No newline at end of file
+#define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS
+
+#ifdef RIFT_IMGUI_ENGINE_VERTEX_LAYOUT
+// ImGui writes its vertices in the layout of core::runtime::graphics::Vertex (position, uv, normal, color), so the
+// backend copies them instead of converting. z and the normal are never written by ImGui; they are cleared on copy
+// and left out of draw list hashes and captures
+// V is not flipped per vertex; textures are uploaded with their rows flipped instead, which also applies to
+// ImTextureIDs that are not the font atlas or from ImGui_CreateTexture
+#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT \
+    struct ImDrawVert { ImVec2 pos; float z; ImVec2 uv; float normal[3]; ImU32 col; }
+#endif
+
+#ifdef RIFT_IMGUI_32BIT_INDICES
+// draw lists past 64k vertices stay a single command instead of being split at ImDrawCmd::VtxOffset
+#define ImDrawIdx unsigned int
+#endif
+
+// every thread has its own current context, so the UIs of different windows can be built in parallel
+struct ImGuiContext;
+extern thread_local ImGuiContext *g_RiftImGuiContext;
+#define GImGui g_RiftImGuiContext
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <Engine/UI/ImGui_Impl_Engine_VertexConvert.hpp>
+
+// checks the vertex kernel picked for this CPU against ImGui_ImplEngine_ConvertVerticesScalar, byte for byte, over
+// random vertices. the lengths cover the empty buffer, every remainder of a short run and buffers far past any
+// cache, the offsets move source and destination through every alignment a 20 or 36 byte stride can land on
+
+namespace engine::ui::tests {
+    static void Test_FillVertices(std::mt19937 &rng, std::vector<ImDrawVert> &vertices) {
+        std::uniform_real_distribution<float> position(-4096.f, 4096.f);
+        std::uniform_real_distribution<float> uv(-0.5f, 1.5f);
+        std::uniform_int_distribution<uint32_t> bits;
+
+        // whatever an ImDrawVert holds besides pos, uv and col is garbage, as it is in ImGui's buffers
+        auto bytes = reinterpret_cast<uint8_t *>(vertices.data());
+
+        for (size_t i = 0; i < vertices.size() * sizeof(ImDrawVert); i++) {
+            bytes[i] = (uint8_t) bits(rng);
+        }
+
+        for (auto &vtx: vertices) {
+            vtx.pos = {position(rng), position(rng)};
+            vtx.uv = {uv(rng), uv(rng)};
+            vtx.col = bits(rng);
+        }
+    }
+
+    static bool Test_Compare(ImGui_ImplEngine_ConvertVerticesFn convert, std::mt19937 &rng, size_t count,
+                             size_t srcOffset, size_t dstOffset) {
+        std::vector<ImDrawVert> src(count + srcOffset);
+        Test_FillVertices(rng, src);
+
+        std::vector<core::runtime::graphics::Vertex> expected(count + dstOffset);
+        std::vector<core::runtime::graphics::Vertex> actual(count + dstOffset);
+        memset((void *) expected.data(), 0, expected.size() * sizeof(core::runtime::graphics::Vertex));
+        memset((void *) actual.data(), 0xCD, actual.size() * sizeof(core::runtime::graphics::Vertex));
+
+        ImGui_ImplEngine_ConvertVerticesScalar(src.data() + srcOffset, expected.data() + dstOffset, count);
+        convert(src.data() + srcOffset, actual.data() + dstOffset, count);
+
+        for (size_t i = 0; i < count; i++) {
+            if (memcmp(&expected[dstOffset + i], &actual[dstOffset + i], sizeof(core::runtime::graphics::Vertex)) != 0) {
+                printf("FAIL: %zu vertices, offsets %zu/%zu: vertex %zu differs from the scalar path\n",
+                       count, srcOffset, dstOffset, i);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static int Test_Main() {
+        auto convert = ImGui_ImplEngine_GetVertexConverter();
+        printf("vertex converter: %s\n", ImGui_ImplEngine_GetVertexConverterName());
+
+        std::mt19937 rng(0x52494654);
+        std::vector<size_t> counts;
+
+        for (size_t count = 0; count <= 67; count++) {
+            counts.push_back(count);
+        }
+
+        for (size_t count: {255, 256, 257, 4093, 65536 + 7, (1 << 20) + 3}) {
+            counts.push_back(count);
+        }
+
+        int failures = 0;
+
+        for (size_t count: counts) {
+            for (size_t offset = 0; offset < 4; offset++) {
+                failures += Test_Compare(convert, rng, count, offset, 3 - offset) ? 0 : 1;
+            }
+        }
+
+        printf("%zu buffer lengths, %d failures\n", counts.size(), failures);
+        return failures == 0 ? 0 : 1;
+    }
+}
+
+int main() {
+    return engine::ui::tests::Test_Main();
+}
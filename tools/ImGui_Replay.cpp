@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <Engine/UI/ImGui.hpp>
+#include <Engine/UI/ImGui_Impl_Engine.hpp>
+#include <Engine/UI/ImGui_Impl_Engine_Capture.hpp>
+
+// replays a capture written by ImGui_StartCapture through ImGui_ImplEngine_RenderDrawData with a headless backend.
+// only the backend is timed: no widgets run and UIRenderItems are counted and dropped, so runs on the same
+// machine compare the conversion and submission paths frame by frame
+
+namespace engine::ui::replay {
+    struct ReplayResult {
+        std::vector<float> m_FrameMs;
+        uint64_t m_Vertices = 0;
+        uint64_t m_Submits = 0;
+        uint64_t m_Inputs = 0;
+        uint32_t m_Frames = 0;
+    };
+
+    static uint64_t g_SubmittedItems = 0;
+
+    static void Replay_Submit(core::runtime::graphics::UIRenderItem &&, void *) {
+        g_SubmittedItems++;
+    }
+
+    static void Replay_DumpInput(const ImGui_ImplEngine_CapturedInput &input) {
+        const auto &event = input.m_Event;
+
+        printf("%10.4f  type %d  char %u  key %u  state %d  pos %.1f,%.1f  finger %d\n", input.m_Time,
+               (int) event.Type, (unsigned) event.UInputChar, (unsigned) event.Key, (int) event.KeyState,
+               (double) event.Position.x, (double) event.Position.y, (int) event.TouchFinger);
+    }
+
+    static bool Replay_Run(const char *path, bool dumpInput, ReplayResult &result) {
+        ImGui_ImplEngine_CaptureReader reader;
+
+        if (!reader.Open(path)) {
+            return false;
+        }
+
+        std::vector<ImGui_ImplEngine_CapturedInput> inputs;
+        ImDrawData *drawData;
+
+        while (reader.NextFrame(drawData, inputs)) {
+            if (dumpInput) {
+                for (const auto &input: inputs) {
+                    Replay_DumpInput(input);
+                }
+            }
+
+            result.m_Inputs += inputs.size();
+            inputs.clear();
+
+            g_SubmittedItems = 0;
+
+            auto start = std::chrono::steady_clock::now();
+            ImGui_ImplEngine_RenderDrawData(drawData);
+            auto end = std::chrono::steady_clock::now();
+
+            result.m_FrameMs.push_back(std::chrono::duration<float, std::milli>(end - start).count());
+
+            ImGui_RenderStats stats;
+            ImGui_ImplEngine_GetRenderStats(stats);
+
+            result.m_Vertices += stats.SubmittedVertexCount;
+            result.m_Submits += g_SubmittedItems;
+            result.m_Frames++;
+        }
+
+        return true;
+    }
+
+    static float Replay_Percentile(std::vector<float> &values, float percentile) {
+        if (values.empty()) {
+            return 0.f;
+        }
+
+        auto idx = (size_t) (percentile * (float) (values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + idx, values.end());
+        return values[idx];
+    }
+
+    static ImGui_RiftFlags Replay_ParseFlags(const char *list) {
+        ImGui_RiftFlags flags = ImGui_RiftFlags_None;
+
+        if (strstr(list, "merge")) { flags |= ImGui_RiftFlags_MergeCommands; }
+        if (strstr(list, "retained")) { flags |= ImGui_RiftFlags_RetainedSubmission; }
+        if (strstr(list, "parallel")) { flags |= ImGui_RiftFlags_ParallelConversion; }
+
+        return flags;
+    }
+
+    static int Replay_Main(int argc, char **argv) {
+        int repeat = 1;
+        bool dumpInput = false;
+        ImGui_RiftFlags flags = ImGui_RiftFlags_None;
+        const char *path = nullptr;
+
+        for (int i = 1; i < argc; i++) {
+            if (!strcmp(argv[i], "--repeat") && i + 1 < argc) {
+                repeat = atoi(argv[++i]);
+            } else if (!strcmp(argv[i], "--flags") && i + 1 < argc) {
+                flags = Replay_ParseFlags(argv[++i]);
+            } else if (!strcmp(argv[i], "--dump-input")) {
+                dumpInput = true;
+            } else if (!path && argv[i][0] != '-') {
+                path = argv[i];
+            } else {
+                path = nullptr;
+                break;
+            }
+        }
+
+        if (!path) {
+            printf("usage: %s [--repeat N] [--flags merge,retained,parallel] [--dump-input] capture.rimc\n", argv[0]);
+            return 1;
+        }
+
+        // draw lists only; no fonts are loaded and no frame is ever built
+        ImGui::CreateContext();
+        ImGui::GetIO().IniFilename = nullptr;
+
+        ImGui_ImplEngine_Init(nullptr, nullptr);
+        ImGui_ImplEngine_SetSubmitHook(Replay_Submit, nullptr);
+        ImGui_ImplEngine_SetFlags(flags);
+
+        ReplayResult result;
+
+        for (int pass = 0; pass < repeat; pass++) {
+            if (!Replay_Run(path, dumpInput && pass == 0, result)) {
+                printf("%s: not a capture of this build (ImDrawVert / ImDrawIdx layout must match)\n", path);
+                return 1;
+            }
+        }
+
+        auto count = (double) (result.m_FrameMs.empty() ? 1 : result.m_FrameMs.size());
+
+        float p50 = Replay_Percentile(result.m_FrameMs, 0.50f);
+        float p90 = Replay_Percentile(result.m_FrameMs, 0.90f);
+        float p99 = Replay_Percentile(result.m_FrameMs, 0.99f);
+        float max = Replay_Percentile(result.m_FrameMs, 1.00f);
+
+        printf("%8s %9s %9s %9s %9s %12s %10s %10s\n",
+               "frames", "p50 ms", "p90 ms", "p99 ms", "max ms", "vtx/frm", "items/frm", "inputs");
+        printf("%8u %9.3f %9.3f %9.3f %9.3f %12.0f %10.1f %10llu\n",
+               result.m_Frames, p50, p90, p99, max,
+               (double) result.m_Vertices / count,
+               (double) result.m_Submits / count,
+               (unsigned long long) (result.m_Inputs / (repeat > 0 ? repeat : 1)));
+
+        ImGui_ImplEngine_Shutdown();
+        ImGui::DestroyContext();
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    return engine::ui::replay::Replay_Main(argc, argv);
+}